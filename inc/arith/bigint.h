@@ -0,0 +1,560 @@
+#ifndef ARITH_BIGINT
+#define ARITH_BIGINT
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Arbitrary precision natural numbers.
+//
+// A BigInt is an array of limbs in base 10^9, least significant first, so that printing one is a
+// matter of printing every limb with nine digits. The product of two limbs fits in 64 bits with room
+// for the carries. Products of large numbers use Karatsuba's algorithm, which splits each operand in two
+// halves and needs three half size products instead of four: O(n^1.585) rather than O(n^2). Squares
+// have their own path, which only computes each cross product a[i] * a[j] once.
+//
+// A zero-initialized BigInt is the number 0. Every function that writes a result accepts a result that
+// is also one of its operands.
+
+#define BIGINT_BASE 1000000000u
+#define BIGINT_DIGITS 9
+#define KARATSUBA_THRESHOLD 48      // limbs, below that the schoolbook product is faster
+
+typedef struct BigInt {
+
+    uint32_t * limbs;
+    int len;        // limbs in use, 0 for the number 0, limbs[len - 1] != 0 otherwise
+    int cap;
+
+} BigInt;
+
+void bigint_free(BigInt * a) {
+
+    free(a->limbs);
+    a->limbs = NULL;
+    a->len = a->cap = 0;
+}
+
+void bigint_reserve(BigInt * a, int cap) {
+
+    if (cap <= a->cap) return;
+
+    if (cap < 2 * a->cap) cap = 2 * a->cap;
+
+    a->limbs = (uint32_t *) realloc(a->limbs, sizeof(uint32_t) * cap);
+    a->cap = cap;
+}
+
+static inline void bigint_trim(BigInt * a) {
+    while (a->len > 0 && a->limbs[a->len - 1] == 0) a->len --;
+}
+
+void bigint_set_u64(BigInt * a, uint64_t x) {
+
+    bigint_reserve(a, 3);
+    a->len = 0;
+
+    while (x > 0) {
+        a->limbs[a->len ++] = x % BIGINT_BASE;
+        x /= BIGINT_BASE;
+    }
+}
+
+void bigint_copy(BigInt * dst, const BigInt * src) {
+
+    if (dst == src) return;
+
+    bigint_reserve(dst, src->len);
+    if (src->len) memcpy(dst->limbs, src->limbs, sizeof(uint32_t) * src->len);
+    dst->len = src->len;
+}
+
+// Exchange two numbers without copying their limbs
+void bigint_swap(BigInt * a, BigInt * b) {
+
+    BigInt tmp = *a;
+    *a = *b;
+    *b = tmp;
+}
+
+static inline bool bigint_is_zero(const BigInt * a) {
+    return a->len == 0;
+}
+
+// The value of `a` if it fits in 64 bits, UINT64_MAX otherwise
+uint64_t bigint_to_u64(const BigInt * a) {
+
+    unsigned __int128 x = 0;
+
+    for (int k = a->len - 1; k >= 0; k --) {
+        x = x * BIGINT_BASE + a->limbs[k];
+        if (x > UINT64_MAX) return UINT64_MAX;
+    }
+
+    return (uint64_t) x;
+}
+
+int bigint_cmp(const BigInt * a, const BigInt * b) {
+
+    if (a->len != b->len) return a->len < b->len ? -1 : 1;
+
+    for (int k = a->len - 1; k >= 0; k --) {
+        if (a->limbs[k] != b->limbs[k]) return a->limbs[k] < b->limbs[k] ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/**========================================================================
+ *                           Limb arrays
+ *========================================================================**/
+
+// r[0 .. max(na, nb) + 1) = a + b, returns the length of the sum
+static int limbs_add(uint32_t * r, const uint32_t * a, int na, const uint32_t * b, int nb) {
+
+    if (na < nb) {
+        const uint32_t * t = a; a = b; b = t;
+        int n = na; na = nb; nb = n;
+    }
+
+    uint32_t carry = 0;
+    int k = 0;
+
+    for (; k < nb; k ++) {
+        uint32_t s = a[k] + b[k] + carry;
+        carry = s >= BIGINT_BASE;
+        r[k] = carry ? s - BIGINT_BASE : s;
+    }
+
+    for (; k < na; k ++) {
+        uint32_t s = a[k] + carry;
+        carry = s >= BIGINT_BASE;
+        r[k] = carry ? s - BIGINT_BASE : s;
+    }
+
+    r[k] = carry;
+
+    return na + carry;
+}
+
+// a -= b, with a >= b
+static void limbs_sub(uint32_t * a, int na, const uint32_t * b, int nb) {
+
+    uint32_t borrow = 0;
+
+    for (int k = 0; k < na && (k < nb || borrow); k ++) {
+
+        uint32_t sub = (k < nb ? b[k] : 0) + borrow;
+
+        borrow = a[k] < sub;
+        a[k] = borrow ? a[k] + BIGINT_BASE - sub : a[k] - sub;
+    }
+}
+
+// r[offset ..] += a, the sum has to fit in the nr limbs of r
+static void limbs_add_at(uint32_t * r, int nr, int offset, const uint32_t * a, int na) {
+
+    uint32_t carry = 0;
+    int k = 0;
+
+    for (; k < na; k ++) {
+        uint32_t s = r[offset + k] + a[k] + carry;
+        carry = s >= BIGINT_BASE;
+        r[offset + k] = carry ? s - BIGINT_BASE : s;
+    }
+
+    for (k += offset; carry && k < nr; k ++) {
+        uint32_t s = r[k] + carry;
+        carry = s >= BIGINT_BASE;
+        r[k] = carry ? s - BIGINT_BASE : s;
+    }
+}
+
+static int limbs_trimmed(const uint32_t * a, int n) {
+
+    while (n > 0 && a[n - 1] == 0) n --;
+    return n;
+}
+
+#define SCHOOLBOOK_ROWS 16          // rows of products added up before the carries are propagated
+
+// r[0 .. na + nb) = a * b, r has to be zeroed. Each product of two limbs is below 10^18, so a 64 bit
+// column can take SCHOOLBOOK_ROWS of them on top of a normalized limb: the carries are only propagated
+// every SCHOOLBOOK_ROWS rows, and the inner loop is a plain multiply-add that the compiler vectorizes
+static void limbs_mul_schoolbook(uint32_t * r, const uint32_t * a, int na, const uint32_t * b, int nb) {
+
+    uint64_t stack[4 * KARATSUBA_THRESHOLD];
+    uint64_t * acc = na + nb <= 4 * KARATSUBA_THRESHOLD ? stack : (uint64_t *) malloc(sizeof(uint64_t) * (na + nb));
+
+    memset(acc, 0, sizeof(uint64_t) * (na + nb));
+
+    for (int i0 = 0; i0 < na; i0 += SCHOOLBOOK_ROWS) {
+
+        int i1 = i0 + SCHOOLBOOK_ROWS < na ? i0 + SCHOOLBOOK_ROWS : na;
+
+        for (int i = i0; i < i1; i ++) {
+
+            uint64_t ai = a[i];
+            uint64_t * row = acc + i;
+
+            for (int j = 0; j < nb; j ++) {
+                row[j] += ai * b[j];
+            }
+        }
+
+        // normalize the columns touched by these rows
+        uint64_t carry = 0;
+
+        for (int k = i0; k < i1 + nb; k ++) {
+            uint64_t cur = acc[k] + carry;
+            carry = cur / BIGINT_BASE;
+            acc[k] = cur - carry * BIGINT_BASE;
+        }
+
+        for (int k = i1 + nb; carry; k ++) {
+            uint64_t cur = acc[k] + carry;
+            carry = cur / BIGINT_BASE;
+            acc[k] = cur - carry * BIGINT_BASE;
+        }
+    }
+
+    for (int k = 0; k < na + nb; k ++) {
+        r[k] = (uint32_t) acc[k];
+    }
+
+    if (acc != stack) free(acc);
+}
+
+// r[0 .. na + nb) = a * b, r has to be zeroed
+static void limbs_mul(uint32_t * r, const uint32_t * a, int na, const uint32_t * b, int nb) {
+
+    if (na < nb) {
+        const uint32_t * t = a; a = b; b = t;
+        int n = na; na = nb; nb = n;
+    }
+
+    if (nb == 0) return;
+
+    if (nb < KARATSUBA_THRESHOLD) {
+        limbs_mul_schoolbook(r, a, na, b, nb);
+        return;
+    }
+
+    int m = na / 2;
+
+    if (nb <= m) { // lopsided: multiply b by slices of a as long as b
+
+        uint32_t * slice = (uint32_t *) malloc(sizeof(uint32_t) * 2 * nb);
+
+        for (int offset = 0; offset < na; offset += nb) {
+
+            int len = na - offset < nb ? na - offset : nb;
+
+            memset(slice, 0, sizeof(uint32_t) * (len + nb));
+            limbs_mul(slice, a + offset, len, b, nb);
+            limbs_add_at(r, na + nb, offset, slice, limbs_trimmed(slice, len + nb));
+        }
+
+        free(slice);
+        return;
+    }
+
+    // a = a1 * B^m + a0, b = b1 * B^m + b0
+    // a * b = z2 * B^2m + (z1 - z2 - z0) * B^m + z0 with z0 = a0 * b0, z2 = a1 * b1, z1 = (a0 + a1)(b0 + b1)
+
+    int na1 = na - m, nb1 = nb - m;
+    int ns = na1 + 1, nt = (nb1 > m ? nb1 : m) + 1;   // na1 >= m, but nb1 may be shorter than b0
+    uint32_t * buffer = (uint32_t *) calloc(ns + nt + ns + nt, sizeof(uint32_t));
+    uint32_t * sa = buffer;
+    uint32_t * sb = sa + ns;
+    uint32_t * z1 = sb + nt;
+
+    // z0 and z2 go straight to their place in r, they don't overlap
+    limbs_mul(r, a, limbs_trimmed(a, m), b, limbs_trimmed(b, m));
+    limbs_mul(r + 2 * m, a + m, na1, b + m, nb1);
+
+    int lsa = limbs_add(sa, a, m, a + m, na1);
+    int lsb = limbs_add(sb, b, m, b + m, nb1);
+
+    limbs_mul(z1, sa, lsa, sb, lsb);
+
+    int nz1 = limbs_trimmed(z1, lsa + lsb);
+
+    limbs_sub(z1, nz1, r, limbs_trimmed(r, 2 * m));
+    limbs_sub(z1, nz1, r + 2 * m, limbs_trimmed(r + 2 * m, na1 + nb1));
+
+    limbs_add_at(r, na + nb, m, z1, limbs_trimmed(z1, nz1));
+
+    free(buffer);
+}
+
+#define SQUARE_ROWS 8               // doubled cross products are below 2 * 10^18, half as many fit in a column
+
+// r[0 .. 2n) = a^2, r has to be zeroed. Same as limbs_mul_schoolbook, but the cross products are only
+// computed once and doubled
+static void limbs_sqr_schoolbook(uint32_t * r, const uint32_t * a, int n) {
+
+    uint64_t stack[4 * KARATSUBA_THRESHOLD];
+    uint64_t * acc = 2 * n <= 4 * KARATSUBA_THRESHOLD ? stack : (uint64_t *) malloc(sizeof(uint64_t) * 2 * n);
+
+    memset(acc, 0, sizeof(uint64_t) * 2 * n);
+
+    for (int i0 = 0; i0 < n; i0 += SQUARE_ROWS) {
+
+        int i1 = i0 + SQUARE_ROWS < n ? i0 + SQUARE_ROWS : n;
+
+        for (int i = i0; i < i1; i ++) {
+
+            uint64_t ai = a[i], twice = 2 * ai;
+            uint64_t * row = acc + i;
+
+            row[i] += ai * ai;
+
+            for (int j = i + 1; j < n; j ++) {
+                row[j] += twice * a[j];
+            }
+        }
+
+        uint64_t carry = 0;
+
+        for (int k = 2 * i0; k < 2 * n; k ++) {
+            uint64_t cur = acc[k] + carry;
+            carry = cur / BIGINT_BASE;
+            acc[k] = cur - carry * BIGINT_BASE;
+        }
+    }
+
+    for (int k = 0; k < 2 * n; k ++) {
+        r[k] = (uint32_t) acc[k];
+    }
+
+    if (acc != stack) free(acc);
+}
+
+// r[0 .. 2n) = a^2, r has to be zeroed
+static void limbs_sqr(uint32_t * r, const uint32_t * a, int n) {
+
+    if (n == 0) return;
+
+    if (n < KARATSUBA_THRESHOLD) {
+        limbs_sqr_schoolbook(r, a, n);
+        return;
+    }
+
+    // a = a1 * B^m + a0, a^2 = z2 * B^2m + (z1 - z2 - z0) * B^m + z0 with z0 = a0^2, z2 = a1^2, z1 = (a0 + a1)^2
+
+    int m = n / 2, n1 = n - m;
+    uint32_t * buffer = (uint32_t *) calloc(n1 + 1 + 2 * (n1 + 1), sizeof(uint32_t));
+    uint32_t * s = buffer;
+    uint32_t * z1 = s + n1 + 1;
+
+    limbs_sqr(r, a, limbs_trimmed(a, m));
+    limbs_sqr(r + 2 * m, a + m, n1);
+
+    int ls = limbs_add(s, a, m, a + m, n1);
+
+    limbs_sqr(z1, s, ls);
+
+    int nz1 = limbs_trimmed(z1, 2 * ls);
+
+    limbs_sub(z1, nz1, r, limbs_trimmed(r, 2 * m));
+    limbs_sub(z1, nz1, r + 2 * m, limbs_trimmed(r + 2 * m, 2 * n1));
+
+    limbs_add_at(r, 2 * n, m, z1, limbs_trimmed(z1, nz1));
+
+    free(buffer);
+}
+
+/**========================================================================
+ *                           Arithmetic
+ *========================================================================**/
+
+void bigint_add(BigInt * r, const BigInt * a, const BigInt * b) {
+
+    int n = (a->len > b->len ? a->len : b->len) + 1;
+
+    if (r == a || r == b) {
+        BigInt tmp = {0};
+        bigint_reserve(&tmp, n);
+        tmp.len = limbs_add(tmp.limbs, a->limbs, a->len, b->limbs, b->len);
+        bigint_swap(r, &tmp);
+        bigint_free(&tmp);
+        return;
+    }
+
+    bigint_reserve(r, n);
+    r->len = limbs_add(r->limbs, a->limbs, a->len, b->limbs, b->len);
+}
+
+// r = a - b, requires a >= b
+void bigint_sub(BigInt * r, const BigInt * a, const BigInt * b) {
+
+    if (r != a) bigint_copy(r, a);
+
+    limbs_sub(r->limbs, r->len, b->limbs, b->len);
+    bigint_trim(r);
+}
+
+// a += x
+void bigint_add_u32(BigInt * a, uint32_t x) {
+
+    bigint_reserve(a, a->len + 2);
+
+    uint64_t carry = x;
+
+    for (int k = 0; carry; k ++) {
+        uint64_t cur = (k < a->len ? a->limbs[k] : 0) + carry;
+        carry = cur / BIGINT_BASE;
+        a->limbs[k] = (uint32_t) (cur - carry * BIGINT_BASE);
+        if (k >= a->len) a->len = k + 1;
+    }
+}
+
+// a -= x, requires a >= x
+void bigint_sub_u32(BigInt * a, uint32_t x) {
+
+    uint32_t small[2] = {x % BIGINT_BASE, x / BIGINT_BASE};
+
+    limbs_sub(a->limbs, a->len, small, small[1] ? 2 : 1);
+    bigint_trim(a);
+}
+
+void bigint_mul(BigInt * r, const BigInt * a, const BigInt * b) {
+
+    BigInt tmp = {0};
+    int n = a->len + b->len;
+
+    bigint_reserve(&tmp, n > 0 ? n : 1);
+    memset(tmp.limbs, 0, sizeof(uint32_t) * tmp.cap);
+
+    limbs_mul(tmp.limbs, a->limbs, a->len, b->limbs, b->len);
+    tmp.len = n;
+    bigint_trim(&tmp);
+
+    bigint_swap(r, &tmp);
+    bigint_free(&tmp);
+}
+
+void bigint_sqr(BigInt * r, const BigInt * a) {
+
+    BigInt tmp = {0};
+    int n = 2 * a->len;
+
+    bigint_reserve(&tmp, n > 0 ? n : 1);
+    memset(tmp.limbs, 0, sizeof(uint32_t) * tmp.cap);
+
+    limbs_sqr(tmp.limbs, a->limbs, a->len);
+    tmp.len = n;
+    bigint_trim(&tmp);
+
+    bigint_swap(r, &tmp);
+    bigint_free(&tmp);
+}
+
+// r = a * x
+void bigint_mul_u32(BigInt * r, const BigInt * a, uint32_t x) {
+
+    bigint_copy(r, a);
+    bigint_reserve(r, r->len + 2);
+
+    uint64_t carry = 0;
+
+    for (int k = 0; k < r->len; k ++) {
+        uint64_t cur = (uint64_t) r->limbs[k] * x + carry;
+        carry = cur / BIGINT_BASE;
+        r->limbs[k] = (uint32_t) (cur - carry * BIGINT_BASE);
+    }
+
+    while (carry) {
+        r->limbs[r->len ++] = carry % BIGINT_BASE;
+        carry /= BIGINT_BASE;
+    }
+
+    bigint_trim(r);
+}
+
+// q = a / x and returns a mod x, for x > 0. `q` may be NULL when only the remainder is needed
+uint64_t bigint_divmod_u64(BigInt * q, const BigInt * a, uint64_t x) {
+
+    if (q) {
+        bigint_copy(q, a);
+        a = q;
+    }
+
+    uint64_t r = 0;
+
+    // r < x, so r * BIGINT_BASE + limb fits in 64 bits as long as x does in 32, which spares the
+    // 128 bit division
+    if (x <= UINT32_MAX) {
+
+        for (int k = a->len - 1; k >= 0; k --) {
+            uint64_t cur = r * BIGINT_BASE + a->limbs[k];
+            if (q) q->limbs[k] = (uint32_t) (cur / x);
+            r = cur % x;
+        }
+
+    } else {
+
+        for (int k = a->len - 1; k >= 0; k --) {
+            unsigned __int128 cur = (unsigned __int128) r * BIGINT_BASE + a->limbs[k];
+            if (q) q->limbs[k] = (uint32_t) (cur / x);
+            r = (uint64_t) (cur % x);
+        }
+    }
+
+    if (q) bigint_trim(q);
+
+    return r;
+}
+
+/**========================================================================
+ *                           Printing
+ *========================================================================**/
+
+int bigint_num_digits(const BigInt * a) {
+
+    if (a->len == 0) return 1;
+
+    int digits = (a->len - 1) * BIGINT_DIGITS;
+    for (uint32_t top = a->limbs[a->len - 1]; top > 0; top /= 10) digits ++;
+
+    return digits;
+}
+
+void bigint_print(FILE * out, const BigInt * a) {
+
+    if (a->len == 0) {
+        fputc('0', out);
+        return;
+    }
+
+    fprintf(out, "%u", a->limbs[a->len - 1]);
+
+    for (int k = a->len - 2; k >= 0; k --) {
+        fprintf(out, "%09u", a->limbs[k]);
+    }
+}
+
+// Decimal string of `a`, to be freed by the caller
+char * bigint_to_string(const BigInt * a) {
+
+    char * s = (char *) malloc(bigint_num_digits(a) + 1);
+    char * p = s;
+
+    if (a->len == 0) {
+        strcpy(s, "0");
+        return s;
+    }
+
+    p += sprintf(p, "%u", a->limbs[a->len - 1]);
+
+    for (int k = a->len - 2; k >= 0; k --) {
+        p += sprintf(p, "%09u", a->limbs[k]);
+    }
+
+    return s;
+}
+
+#endif
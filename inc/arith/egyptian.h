@@ -0,0 +1,91 @@
+#ifndef ARITH_EGYPTIAN
+#define ARITH_EGYPTIAN
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bigint.h"
+#include "gcd.h"
+
+// Egyptian fractions by the greedy algorithm of Fibonacci.
+//
+// The largest unit fraction below n/d is 1/x with x = ceil(d/n), and
+//
+//      n/d - 1/x = (n x - d) / (d x)
+//
+// where n x - d = n - (d mod n) < n: the numerators decrease, so the expansion of n/d has at most n terms
+// and the numerator always fits in 64 bits. The denominators, on the other hand, roughly square at every
+// step (d x ~ d^2 / n), so they are BigInts. A step is a division of the denominator by the numerator,
+// a product and a gcd to keep the fraction reduced, each linear in the size of the denominator but for
+// the product.
+
+typedef struct EgyptianFraction {
+
+    BigInt * den;                   // increasing, n/d = 1/den[0] + ... + 1/den[length - 1]
+    int length;
+    int cap;                        // den[length .. cap - 1] keep their limbs for the next expansion
+
+} EgyptianFraction;
+
+void egyptian_free(EgyptianFraction * ef) {
+
+    for (int k = 0; k < ef->cap; k ++) bigint_free(&ef->den[k]);
+
+    free(ef->den);
+    ef->den = NULL;
+    ef->length = ef->cap = 0;
+}
+
+// The next denominator of `ef`
+static BigInt * egyptian_push(EgyptianFraction * ef) {
+
+    if (ef->length == ef->cap) {
+
+        int cap = ef->cap ? 2 * ef->cap : 8;
+
+        ef->den = (BigInt *) realloc(ef->den, sizeof(BigInt) * cap);
+        memset(ef->den + ef->cap, 0, sizeof(BigInt) * (cap - ef->cap));
+        ef->cap = cap;
+    }
+
+    return &ef->den[ef->length ++];
+}
+
+// Greedy expansion of n/d into `ef`, for 0 < n <= d. `ef` is either zero-initialized or the result of a
+// previous expansion, whose storage gets reused
+void egyptian_fraction_decomp(uint64_t n, uint64_t d, EgyptianFraction * ef) {
+
+    ef->length = 0;
+
+    uint64_t g = gcd_u64(n, d);
+    n /= g;
+    d /= g;
+
+    BigInt den = {0};
+    bigint_set_u64(&den, d);
+
+    while (true) {
+
+        BigInt * x = egyptian_push(ef);
+        uint64_t r = bigint_divmod_u64(x, &den, n);
+
+        if (r == 0) break;          // n/d = 1/x
+
+        // x = ceil(d/n), the rest is (n - r) / (d x)
+        bigint_add_u32(x, 1);
+        bigint_mul(&den, &den, x);
+        n -= r;
+
+        g = gcd_u64(n, bigint_divmod_u64(NULL, &den, n));
+
+        if (g > 1) {
+            n /= g;
+            bigint_divmod_u64(&den, &den, g);
+        }
+    }
+
+    bigint_free(&den);
+}
+
+#endif
@@ -0,0 +1,211 @@
+#ifndef ARITH_FACTOR
+#define ARITH_FACTOR
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "sieve.h"
+#include "primality.h"
+#include "gcd.h"
+
+// Factorisation of 64 bit integers.
+//
+//  1. Trial division by the primes below FACTOR_TRIAL_LIMIT, from a table built once (init_factor_table).
+//     A prime p divides n iff n p^-1 mod 2^64 <= (2^64 - 1) / p, so the table holds p^-1 and that bound
+//     rather than p, and trial division costs a multiplication per prime. It stops as soon as p^2 > n.
+//  2. The cofactor is then 1, a prime (is_prime of primality.h), or has no factor below the limit and is
+//     split by Pollard's rho in the variant of Brent: the sequence x -> x^2 + c mod n eventually cycles
+//     modulo any prime factor q of n, after about sqrt(q) steps, which gcd(x_i - x_j, n) reveals. The
+//     differences are multiplied together for FACTOR_GCD_BATCH steps before taking a single gcd, with
+//     Montgomery products. Both parts are factored again until only primes are left.
+
+#define FACTOR_TRIAL_LIMIT 4096
+#define FACTOR_GCD_BATCH 128
+#define MAX_PRIME_FACTORS 15            // 2 * 3 * 5 * ... * 47 > 2^64
+
+typedef struct Factorization {
+
+    int count;                          // distinct prime factors
+    uint64_t primes[MAX_PRIME_FACTORS]; // increasing
+    uint8_t exponents[MAX_PRIME_FACTORS];
+
+} Factorization;
+
+typedef struct TrialPrime {
+
+    uint32_t prime;
+    uint64_t inverse;                   // prime^-1 mod 2^64
+    uint64_t limit;                     // (2^64 - 1) / prime
+
+} TrialPrime;
+
+TrialPrime * FACTOR_TABLE = NULL;
+uint32_t FACTOR_TABLE_SIZE = 0;         // odd primes below FACTOR_TRIAL_LIMIT
+
+// Build the table of trial divisors, and the one of is_prime. Not thread safe: call it before starting
+// threads that factor
+void init_factor_table() {
+
+    init_trial_division();
+
+    if (FACTOR_TABLE) return;
+
+    uint32_t count = 0;
+    uint32_t * primes = small_primes(FACTOR_TRIAL_LIMIT, &count);
+
+    FACTOR_TABLE = (TrialPrime *) malloc(sizeof(TrialPrime) * count);
+
+    for (uint32_t k = 1; k < count; k ++) { // 2 is a shift
+
+        uint64_t p = primes[k], x = p;
+        for (int i = 0; i < 5; i ++) x *= 2 - p * x;
+
+        FACTOR_TABLE[FACTOR_TABLE_SIZE ++] = (TrialPrime) {(uint32_t) p, x, UINT64_MAX / p};
+    }
+
+    free(primes);
+}
+
+// Add p^e to `f`, keeping the primes sorted
+static void factorization_add(Factorization * f, uint64_t p, int e) {
+
+    int k = 0;
+
+    while (k < f->count && f->primes[k] < p) k ++;
+
+    if (k < f->count && f->primes[k] == p) {
+        f->exponents[k] += e;
+        return;
+    }
+
+    for (int j = f->count; j > k; j --) {
+        f->primes[j] = f->primes[j - 1];
+        f->exponents[j] = f->exponents[j - 1];
+    }
+
+    f->primes[k] = p;
+    f->exponents[k] = e;
+    f->count ++;
+}
+
+/**========================================================================
+ *                           Pollard-Brent
+ *========================================================================**/
+
+static inline uint64_t mod_add(uint64_t a, uint64_t b, uint64_t n) {
+
+    uint64_t s = a + b;
+    return s < a || s >= n ? s - n : s;
+}
+
+// A non trivial factor of the odd composite n, which has no factor below FACTOR_TRIAL_LIMIT
+uint64_t pollard_brent(uint64_t n) {
+
+    Montgomery m = montgomery_init(n);
+
+    for (uint64_t c0 = 1; ; c0 ++) {
+
+        uint64_t c = to_montgomery(&m, c0);
+        uint64_t x = 0, y = to_montgomery(&m, 2), ys = y;
+        uint64_t q = m.one, g = 1;
+
+        for (uint64_t r = 1; g == 1; r <<= 1) {
+
+            x = y;
+            for (uint64_t i = 0; i < r; i ++) y = mod_add(mont_mul(&m, y, y), c, n);
+
+            for (uint64_t k = 0; k < r && g == 1; k += FACTOR_GCD_BATCH) {
+
+                uint64_t steps = r - k < FACTOR_GCD_BATCH ? r - k : FACTOR_GCD_BATCH;
+                ys = y;
+
+                for (uint64_t i = 0; i < steps; i ++) {
+                    y = mod_add(mont_mul(&m, y, y), c, n);
+                    q = mont_mul(&m, q, x > y ? x - y : y - x);
+                }
+
+                g = gcd_u64(q, n);
+            }
+        }
+
+        // the batch went past the factor, or found all of n at once: step again one gcd at a time
+        if (g == n) {
+            do {
+                ys = mod_add(mont_mul(&m, ys, ys), c, n);
+                g = gcd_u64(x > ys ? x - ys : ys - x, n);
+            } while (g == 1);
+        }
+
+        if (g != n) return g;
+    }
+}
+
+// Add the prime factors of n, which has no factor below FACTOR_TRIAL_LIMIT, to `f`
+static void factor_large(uint64_t n, int e, Factorization * f) {
+
+    if (n == 1) return;
+
+    if ( is_prime(n) ) {
+        factorization_add(f, n, e);
+        return;
+    }
+
+    uint64_t d = pollard_brent(n);
+    uint64_t cofactor = n / d;
+
+    // d^k cofactor with k as large as possible, so that d doesn't get factored twice
+    int k = 1;
+
+    while (cofactor % d == 0) {
+        cofactor /= d;
+        k ++;
+    }
+
+    factor_large(d, e * k, f);
+    factor_large(cofactor, e, f);
+}
+
+/**========================================================================
+ *                           Factorisation
+ *========================================================================**/
+
+// The prime factors of n >= 1, init_factor_table having been called
+Factorization factor(uint64_t n) {
+
+    Factorization f = {0};
+
+    if (n < 2) return f;
+
+    if ((n & 1) == 0) {
+        int e = __builtin_ctzll(n);
+        factorization_add(&f, 2, e);
+        n >>= e;
+    }
+
+    for (uint32_t k = 0; k < FACTOR_TABLE_SIZE; k ++) {
+
+        const TrialPrime * t = &FACTOR_TABLE[k];
+
+        if ((uint64_t) t->prime * t->prime > n) break;
+
+        if (n * t->inverse <= t->limit) {
+
+            int e = 0;
+
+            do {
+                n *= t->inverse;                // exact division
+                e ++;
+            } while (n * t->inverse <= t->limit);
+
+            factorization_add(&f, t->prime, e);
+        }
+    }
+
+    // what is left has no factor below FACTOR_TRIAL_LIMIT, it is prime when below its square
+    if (n > 1 && n < (uint64_t) FACTOR_TRIAL_LIMIT * FACTOR_TRIAL_LIMIT) factorization_add(&f, n, 1);
+    else factor_large(n, 1, &f);
+
+    return f;
+}
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef ARITH_FIBONACCI
+#define ARITH_FIBONACCI
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "bigint.h"
+
+// Fibonacci numbers by fast doubling.
+//
+// With F(0) = 0 and F(1) = 1,
+//
+//      F(2k - 1) = F(k)^2 + F(k - 1)^2
+//      F(2k + 1) = 4 F(k)^2 - F(k - 1)^2 + 2 (-1)^k
+//      F(2k)     = F(2k + 1) - F(2k - 1)
+//
+// so the pair (F(n - 1), F(n)) follows from (F(n / 2 - 1), F(n / 2)) with two squares, and F(n) from the
+// bits of n, most significant first: O(log n) steps, the last ones dominating since the numbers double
+// in size at every step. Up to F(93) everything fits in 64 bits and comes from a table.
+//
+// A FibCache remembers the pairs of the last queries. Every prefix of the bits of n is a point that the
+// doubling goes through, so a query starts from the longest prefix of n found in the cache: asking for
+// n again costs nothing, and asking for 2n or 2n + 1 costs a single step.
+
+#define FIB_TABLE_SIZE 94           // F(93) is the largest Fibonacci number below 2^64
+#define FIB_CACHE_SIZE 64
+
+typedef struct FibEntry {
+
+    bool used;
+    uint64_t n;
+    uint64_t last_use;
+    BigInt f0;                      // F(n - 1)
+    BigInt f1;                      // F(n)
+
+} FibEntry;
+
+typedef struct FibCache {
+
+    FibEntry entries[FIB_CACHE_SIZE];
+    uint64_t clock;
+    uint64_t hits;                  // queries that started from a cached pair
+    uint64_t misses;
+
+} FibCache;
+
+uint64_t FIB_TABLE[FIB_TABLE_SIZE + 1];
+bool FIB_TABLE_READY = false;
+
+void init_fib_table() {
+
+    if (FIB_TABLE_READY) return;
+
+    FIB_TABLE[0] = 0;
+    FIB_TABLE[1] = 1;
+
+    for (int k = 2; k <= FIB_TABLE_SIZE; k ++) {
+        FIB_TABLE[k] = FIB_TABLE[k - 1] + FIB_TABLE[k - 2]; // F(94) wraps around, it is never read
+    }
+
+    FIB_TABLE_READY = true;
+}
+
+void fib_cache_free(FibCache * cache) {
+
+    for (int k = 0; k < FIB_CACHE_SIZE; k ++) {
+        bigint_free(&cache->entries[k].f0);
+        bigint_free(&cache->entries[k].f1);
+        cache->entries[k].used = false;
+    }
+}
+
+FibEntry * fib_cache_find(FibCache * cache, uint64_t n) {
+
+    for (int k = 0; k < FIB_CACHE_SIZE; k ++) {
+        if (cache->entries[k].used && cache->entries[k].n == n) return &cache->entries[k];
+    }
+
+    return NULL;
+}
+
+void fib_cache_store(FibCache * cache, uint64_t n, const BigInt * f0, const BigInt * f1) {
+
+    if (fib_cache_find(cache, n)) return;
+
+    FibEntry * victim = &cache->entries[0];
+
+    for (int k = 0; k < FIB_CACHE_SIZE; k ++) {
+
+        FibEntry * e = &cache->entries[k];
+
+        if (!e->used) {
+            victim = e;
+            break;
+        }
+
+        if (e->last_use < victim->last_use) victim = e;
+    }
+
+    victim->used = true;
+    victim->n = n;
+    victim->last_use = ++ cache->clock;
+    bigint_copy(&victim->f0, f0);
+    bigint_copy(&victim->f1, f1);
+}
+
+// (f0, f1) = (F(2k - 1), F(2k)) from (F(k - 1), F(k)), or (F(2k), F(2k + 1)) if `odd`. `t` is scratch space
+void fib_double(BigInt * f0, BigInt * f1, BigInt * t, uint64_t k, bool odd) {
+
+    bigint_sqr(f0, f0);             // F(k - 1)^2
+    bigint_sqr(f1, f1);             // F(k)^2
+
+    bigint_mul_u32(t, f1, 4);
+    bigint_sub(t, t, f0);
+    if (k & 1) bigint_sub_u32(t, 2);
+    else bigint_add_u32(t, 2);      // F(2k + 1)
+
+    bigint_add(f0, f0, f1);         // F(2k - 1)
+    bigint_sub(f1, t, f0);          // F(2k)
+
+    if (odd) {
+        bigint_swap(f0, f1);
+        bigint_swap(f1, t);
+    }
+}
+
+// (F(n - 1), F(n)) for n >= 1, using and filling `cache` unless it is NULL
+static void fib_prev_pair(uint64_t n, BigInt * f0, BigInt * f1, FibCache * cache) {
+
+    init_fib_table();
+
+    if (n < FIB_TABLE_SIZE) {
+        bigint_set_u64(f0, FIB_TABLE[n - 1]);
+        bigint_set_u64(f1, FIB_TABLE[n]);
+        return;
+    }
+
+    // start from the longest prefix of n that we know, or from the table
+    int shift = 64 - __builtin_clzll(n);
+    FibEntry * start = NULL;
+
+    if (cache) {
+        for (int s = 0; s < shift && start == NULL; s ++) {
+            if ( (n >> s) >= FIB_TABLE_SIZE ) start = fib_cache_find(cache, n >> s);
+            if (start) shift = s;
+        }
+    }
+
+    if (start) {
+        cache->hits ++;
+        start->last_use = ++ cache->clock;
+        bigint_copy(f0, &start->f0);
+        bigint_copy(f1, &start->f1);
+    } else {
+        while ( shift > 0 && (n >> (shift - 1)) < FIB_TABLE_SIZE ) shift --;
+        uint64_t k = n >> shift;
+        bigint_set_u64(f0, FIB_TABLE[k - 1]);
+        bigint_set_u64(f1, FIB_TABLE[k]);
+        if (cache) cache->misses ++;
+    }
+
+    BigInt t = {0};
+
+    for (int s = shift - 1; s >= 0; s --) {
+        fib_double(f0, f1, &t, n >> (s + 1), (n >> s) & 1);
+    }
+
+    bigint_free(&t);
+
+    if (cache) fib_cache_store(cache, n, f0, f1);
+}
+
+// (F(n), F(n + 1)), using and filling `cache` unless it is NULL
+void fib_pair(uint64_t n, BigInt * f0, BigInt * f1, FibCache * cache) {
+
+    if (n == 0) {
+        bigint_set_u64(f0, 0);
+        bigint_set_u64(f1, 1);
+        return;
+    }
+
+    fib_prev_pair(n, f1, f0, cache);    // f1 = F(n - 1), f0 = F(n)
+    bigint_add(f1, f1, f0);
+}
+
+// F(n)
+void fib(uint64_t n, BigInt * result, FibCache * cache) {
+
+    BigInt next = {0};
+    fib_pair(n, result, &next, cache);
+    bigint_free(&next);
+}
+
+#endif
@@ -0,0 +1,705 @@
+#ifndef ARITH_PRIMALITY
+#define ARITH_PRIMALITY
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+// Deterministic primality test for 64 bit integers.
+//
+// Small factors are found by trial division, then Miller-Rabin runs with the seven bases of Jim
+// Sinclair, which no composite below 2^64 passes for all of them. The modular products are Montgomery
+// products: with R = 2^64, a number x is kept as x R mod n and a product costs three 64 x 64 bit
+// multiplications and no division.
+//
+// is_prime_batch tests arrays of candidates with the Baillie-PSW test instead: after trial division, a
+// Miller-Rabin round of base 2, then a strong Lucas test with Selfridge's parameters. The composites below
+// 2^64 that pass the base 2 are listed (Feitsma) and all of them fail the Lucas test, so the two functions
+// agree, and a prime costs the base 2 and one Lucas test, worth about three rounds, instead of seven
+// rounds. Each test runs on the whole batch, keeping only the candidates that pass: most composites are out
+// after the base 2, whose powers only need squares and doublings.
+//
+// The tests run MR_LANES candidates in lockstep, so that the processor works on MR_LANES independent chains
+// of multiplications at once instead of waiting for the result of each one before starting the next. On
+// x86 processors with AVX-512 IFMA (checked at run time), they run on 8 candidates per 512 bit vector,
+// IFMA_VECTORS vectors at a time, with the 52 bit multipliers of IFMA, and the scalar lanes only take the
+// last candidates.
+
+#define MR_LANES 4
+#define IFMA_VECTORS 4              // vectors of 8 lanes in flight in the AVX-512 IFMA tests
+#define IFMA_LANES (8 * IFMA_VECTORS)
+#define NUM_MR_BASES 7
+#define NUM_TRIAL_PRIMES 15
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define PRIME_IFMA
+#include <immintrin.h>
+#endif
+
+const uint64_t MR_BASES[NUM_MR_BASES] = {2, 325, 9375, 28178, 450775, 9780504, 1795265022};
+const uint32_t TRIAL_PRIMES[NUM_TRIAL_PRIMES] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47};
+
+/**========================================================================
+ *                           Montgomery arithmetic
+ *========================================================================**/
+
+typedef struct Montgomery {
+
+    uint64_t n;                 // odd modulus
+    uint64_t n_inv;             // n^-1 mod 2^64
+    uint64_t one;               // R mod n
+    uint64_t r2;                // R^2 mod n
+
+} Montgomery;
+
+// n^-1 mod 2^64 for an odd n
+static inline uint64_t montgomery_inverse(uint64_t n) {
+
+    // Newton's iteration doubles the number of correct low bits, and n is its own inverse mod 8
+    uint64_t x = n;
+    for (int k = 0; k < 5; k ++) x *= 2 - n * x;
+
+    return x;
+}
+
+static inline Montgomery montgomery_init(uint64_t n) {
+
+    Montgomery m = {.n = n, .n_inv = montgomery_inverse(n)};
+
+    m.one = -n % n;
+    m.r2 = (unsigned __int128) m.one * m.one % n;
+
+    return m;
+}
+
+// a b R^-1 mod n, for a, b < n
+static inline uint64_t mont_mul(const Montgomery * m, uint64_t a, uint64_t b) {
+
+    unsigned __int128 t = (unsigned __int128) a * b;
+    uint64_t lo = (uint64_t) t, hi = (uint64_t) (t >> 64);
+
+    // lo - q n = 0 mod 2^64, so (t - q n) / 2^64 = hi - floor(q n / 2^64), which lies in (-n, n)
+    uint64_t q = lo * m->n_inv;
+    uint64_t qn_hi = (uint64_t) (((unsigned __int128) q * m->n) >> 64);
+
+    return hi >= qn_hi ? hi - qn_hi : hi - qn_hi + m->n;
+}
+
+static inline uint64_t to_montgomery(const Montgomery * m, uint64_t x) {
+    return mont_mul(m, x % m->n, m->r2);
+}
+
+static inline uint64_t from_montgomery(const Montgomery * m, uint64_t x) {
+    return mont_mul(m, x, 1);
+}
+
+// a^e, a in Montgomery form
+static inline uint64_t mont_pow(const Montgomery * m, uint64_t a, uint64_t e) {
+
+    uint64_t x = m->one;
+
+    for (; e; e >>= 1) {
+        if (e & 1) x = mont_mul(m, x, a);
+        a = mont_mul(m, a, a);
+    }
+
+    return x;
+}
+
+/**========================================================================
+ *                           Miller-Rabin
+ *========================================================================**/
+
+// An odd p divides n iff n p^-1 mod 2^64 <= (2^64 - 1) / p: the multiples of p are the only numbers that
+// multiplying by p^-1 maps to [0, (2^64 - 1) / p], which spares the trial division its divisions
+uint64_t TRIAL_INVERSES[NUM_TRIAL_PRIMES];
+uint64_t TRIAL_LIMITS[NUM_TRIAL_PRIMES];
+bool TRIAL_READY = false;
+
+// Not thread safe: threads calling is_prime or trial_division need it to have run before they start
+void init_trial_division() {
+
+    if (TRIAL_READY) return;
+
+    for (int k = 1; k < NUM_TRIAL_PRIMES; k ++) {
+
+        uint64_t p = TRIAL_PRIMES[k], x = p;
+        for (int i = 0; i < 5; i ++) x *= 2 - p * x;
+
+        TRIAL_INVERSES[k] = x;
+        TRIAL_LIMITS[k] = UINT64_MAX / p;
+    }
+
+    TRIAL_READY = true;
+}
+
+// 1 if `n` is prime or 0 if it isn't, as far as trial division tells, -1 if it doesn't tell
+static inline int trial_division(uint64_t n) {
+
+    if (n < 2) return 0;
+    if ((n & 1) == 0) return n == 2;
+
+    init_trial_division();
+
+    for (int k = 1; k < NUM_TRIAL_PRIMES; k ++) {
+        if (n * TRIAL_INVERSES[k] <= TRIAL_LIMITS[k]) return n == TRIAL_PRIMES[k];
+    }
+
+    return n < 53 * 53 ? 1 : -1;
+}
+
+// The end of a Miller-Rabin round: x = a^d with n - 1 = d 2^s
+static inline bool mr_round_passes(const Montgomery * m, uint64_t x, int s) {
+
+    uint64_t minus_one = m->n - m->one;
+
+    if (x == m->one || x == minus_one) return true;
+
+    for (int k = 1; k < s; k ++) {
+        x = mont_mul(m, x, x);
+        if (x == minus_one) return true;
+        if (x == m->one) return false;
+    }
+
+    return false;
+}
+
+// Miller-Rabin with every base, for an odd n without small factors
+bool miller_rabin(uint64_t n) {
+
+    Montgomery m = montgomery_init(n);
+    int s = __builtin_ctzll(n - 1);
+    uint64_t d = (n - 1) >> s;
+
+    for (int b = 0; b < NUM_MR_BASES; b ++) {
+
+        uint64_t a = MR_BASES[b] % n;
+        if (a == 0) continue;
+
+        if ( !mr_round_passes(&m, mont_pow(&m, to_montgomery(&m, a), d), s) ) return false;
+    }
+
+    return true;
+}
+
+bool is_prime(uint64_t n) {
+
+    int t = trial_division(n);
+    return t >= 0 ? t : miller_rabin(n);
+}
+
+/**========================================================================
+ *                           Batches
+ *========================================================================**/
+
+typedef struct PrimeLane {
+
+    size_t index;               // of the candidate in the batch
+    Montgomery m;               // without r2, that the batch never needs
+    uint64_t d;                 // odd part of n - 1, then of n + 1 for the Lucas test
+    int s;
+    uint64_t q;                 // Q of the Lucas sequence, in Montgomery form
+
+} PrimeLane;
+
+// 2 x mod n, for x < n
+static inline uint64_t mod_double(uint64_t x, uint64_t n) {
+
+    uint64_t y = x + x;
+    return y < x || y >= n ? y - n : y;
+}
+
+// x - y mod n, for x, y < n
+static inline uint64_t mod_sub(uint64_t x, uint64_t y, uint64_t n) {
+    return x - y + (n & -(uint64_t) (x < y));
+}
+
+// Jacobi symbol (a / n) for an odd n
+static int jacobi(uint64_t a, uint64_t n) {
+
+    int j = 1;
+
+    a %= n;
+
+    while (a) {
+
+        int z = __builtin_ctzll(a);
+        a >>= z;
+        if ((z & 1) && ((n & 7) == 3 || (n & 7) == 5)) j = -j;
+
+        if ((a & 3) == 3 && (n & 3) == 3) j = -j;
+
+        uint64_t t = n % a;
+        n = a;
+        a = t;
+    }
+
+    return n == 1 ? j : 0;
+}
+
+static bool is_square(uint64_t n) {
+
+    // the squares are 12 of the 64 residues mod 64
+    if ( !((0x0202021202030213ULL >> (n & 63)) & 1) ) return false;
+
+    // Newton's iteration from above
+    uint64_t x = 1ULL << ((64 - __builtin_clzll(n)) / 2 + 1);
+
+    for (uint64_t y = (x + n / x) / 2; y < x; y = (x + n / x) / 2) x = y;
+
+    return x * x == n;
+}
+
+// 2^d in Montgomery form for every lane, left to right: square, and double when the bit of d is set. The
+// lanes are aligned on their last bit, a lane whose d is shorter keeps its first value meanwhile. Every
+// lane is computed on every step without a branch, so that the MR_LANES chains overlap
+static void mr_pow2_lanes(const PrimeLane * lanes, uint64_t * x) {
+
+    uint64_t n[MR_LANES], n_inv[MR_LANES], d[MR_LANES];
+    int steps[MR_LANES], longest = 0;
+
+    for (int l = 0; l < MR_LANES; l ++) {
+        n[l] = lanes[l].m.n;
+        n_inv[l] = lanes[l].m.n_inv;
+        d[l] = lanes[l].d;
+        x[l] = mod_double(lanes[l].m.one, n[l]);                        // the top bit of d
+        steps[l] = 63 - __builtin_clzll(d[l]);
+        if (steps[l] > longest) longest = steps[l];
+    }
+
+    for (int step = longest - 1; step >= 0; step --) {
+        for (int l = 0; l < MR_LANES; l ++) {
+
+            unsigned __int128 t = (unsigned __int128) x[l] * x[l];
+            uint64_t lo = (uint64_t) t, hi = (uint64_t) (t >> 64);
+            uint64_t qn_hi = (uint64_t) (((unsigned __int128) (lo * n_inv[l]) * n[l]) >> 64);
+            uint64_t y = hi - qn_hi + (n[l] & -(uint64_t) (hi < qn_hi));
+
+            uint64_t double_mask = -((d[l] >> step) & 1);
+            uint64_t keep_mask = -(uint64_t) (step >= steps[l]);
+            uint64_t y2 = y + (y & double_mask);
+            y2 -= n[l] & -(uint64_t) ((y2 < y) | (y2 >= n[l]));
+
+            x[l] = (x[l] & keep_mask) | (y2 & ~keep_mask);
+        }
+    }
+}
+
+// The strong Lucas test with P = 1 for MR_LANES lanes at once, pass[l] telling the outcome. With
+// n + 1 = d 2^s, V_d, V_(d+1) and Q^d come from a ladder on the bits of d:
+//
+//      V_2k = V_k^2 - 2 Q^k        V_(2k+1) = V_k V_(k+1) - Q^k        V_(2k+2) = V_(k+1)^2 - 2 Q^(k+1)
+//
+// and n passes if U_d = 0, that is 2 V_(d+1) = V_d as D is invertible, or if V_(d 2^r) = 0 for some r < s.
+// Like mr_pow2_lanes, every lane does the four products of every step
+static void lucas_lanes(const PrimeLane * lanes, bool * pass) {
+
+    uint64_t v0[MR_LANES], v1[MR_LANES], qk[MR_LANES];
+    int longest = 0;
+
+    for (int l = 0; l < MR_LANES; l ++) {
+        v0[l] = mod_double(lanes[l].m.one, lanes[l].m.n);               // V_0 = 2
+        v1[l] = lanes[l].m.one;                                         // V_1 = P
+        qk[l] = lanes[l].m.one;                                         // Q^0
+        int bits = 64 - __builtin_clzll(lanes[l].d);
+        if (bits > longest) longest = bits;
+    }
+
+    for (int step = longest - 1; step >= 0; step --) {
+        for (int l = 0; l < MR_LANES; l ++) {
+
+            const Montgomery * m = &lanes[l].m;
+            uint64_t bit = -((lanes[l].d >> step) & 1);                 // leading zeros keep k = 0
+
+            uint64_t qk1 = mont_mul(m, qk[l], lanes[l].q);
+            uint64_t q_sel = (qk1 & bit) | (qk[l] & ~bit);
+            uint64_t v_sel = (v1[l] & bit) | (v0[l] & ~bit);
+
+            uint64_t cross = mod_sub(mont_mul(m, v0[l], v1[l]), qk[l], m->n);
+            uint64_t square = mod_sub(mont_mul(m, v_sel, v_sel), mod_double(q_sel, m->n), m->n);
+
+            v0[l] = (cross & bit) | (square & ~bit);
+            v1[l] = (square & bit) | (cross & ~bit);
+            qk[l] = mont_mul(m, qk[l], q_sel);
+        }
+    }
+
+    for (int l = 0; l < MR_LANES; l ++) {
+
+        const Montgomery * m = &lanes[l].m;
+        uint64_t v = v0[l], q = qk[l];
+
+        pass[l] = mod_double(v1[l], m->n) == v;
+
+        for (int r = 0; r < lanes[l].s && !pass[l]; r ++) {
+            pass[l] = v == 0;
+            v = mod_sub(mont_mul(m, v, v), mod_double(q, m->n), m->n);
+            q = mont_mul(m, q, q);
+        }
+    }
+}
+
+// Selfridge's choice of D among 5, -7, 9, -11, ... with (D / n) = -1, P = 1 and Q = (1 - D) / 4. Sets the
+// lane up for lucas_lanes and returns true, or returns false when n is a square or D shares a factor with n
+static bool lucas_setup(PrimeLane * lane) {
+
+    uint64_t n = lane->m.n;
+
+    if ( is_square(n) ) return false;                                   // (D / n) is never -1
+
+    int64_t D = 5;
+    int j;
+
+    while ((j = jacobi(D > 0 ? (uint64_t) D : n - (uint64_t) -D, n)) == 1) {
+        D = D > 0 ? -D - 2 : -D + 2;
+    }
+
+    int64_t Q = (1 - D) / 4;
+
+    // n > |D|, |Q| since trial division left no n < 53^2, so a common factor means that n is composite
+    if (j == 0 || jacobi(Q > 0 ? (uint64_t) Q : (uint64_t) -Q, n) == 0) return false;
+
+    // Q R mod n, |Q| being small
+    uint64_t q = 0, x = lane->m.one;
+
+    for (uint64_t k = Q > 0 ? (uint64_t) Q : (uint64_t) -Q; k; k >>= 1) {
+        if (k & 1) q = mod_sub(q, n - x, n);
+        x = mod_double(x, n);
+    }
+
+    lane->q = Q > 0 ? q : mod_sub(0, q, n);
+    lane->s = __builtin_ctzll(n + 1);                                   // n < 2^64 - 1, a multiple of 3
+    lane->d = (n + 1) >> lane->s;
+
+    return true;
+}
+
+#ifdef PRIME_IFMA
+
+#define LIMB_MASK 0xFFFFFFFFFFFFFULL                // 52 bits
+
+// The moduli of 8 lanes. The multipliers of IFMA take 52 bit operands, so the products are Montgomery
+// products with R' = 2^104 and two limbs of 52 bits instead of R = 2^64
+typedef struct IfmaModulus {
+
+    __m512i n;
+    __m512i n0, n1;             // low and high limbs of n
+    __m512i n_inv;              // -n^-1 mod 2^52
+
+} IfmaModulus;
+
+// a b R'^-1 mod n on 8 lanes, for a, b < n. Each limb of a is multiplied by b, then a multiple of n clears
+// the lowest limb of the sum, which is dropped. The result is below 2n, so that a subtraction makes it < n
+__attribute__((target("avx512f,avx512ifma")))
+static inline __m512i mont_mul_ifma(const IfmaModulus * m, __m512i a, __m512i b) {
+
+    const __m512i mask = _mm512_set1_epi64(LIMB_MASK), zero = _mm512_setzero_si512();
+
+    __m512i a0 = _mm512_and_si512(a, mask), a1 = _mm512_srli_epi64(a, 52);
+    __m512i b0 = _mm512_and_si512(b, mask), b1 = _mm512_srli_epi64(b, 52);
+
+    __m512i t0 = _mm512_madd52lo_epu64(zero, a0, b0);
+    __m512i t1 = _mm512_madd52lo_epu64(_mm512_madd52hi_epu64(zero, a0, b0), a0, b1);
+    __m512i t2 = _mm512_madd52hi_epu64(zero, a0, b1);
+    __m512i q = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t0, m->n_inv), mask);
+
+    t0 = _mm512_madd52lo_epu64(t0, q, m->n0);
+    t1 = _mm512_madd52lo_epu64(_mm512_madd52hi_epu64(t1, q, m->n0), q, m->n1);
+    t2 = _mm512_madd52hi_epu64(t2, q, m->n1);
+
+    // the lowest limb is 0 but for its carry
+    t0 = _mm512_madd52lo_epu64(_mm512_add_epi64(t1, _mm512_srli_epi64(t0, 52)), a1, b0);
+    t1 = _mm512_madd52lo_epu64(_mm512_madd52hi_epu64(t2, a1, b0), a1, b1);
+    t2 = _mm512_madd52hi_epu64(zero, a1, b1);
+    q = _mm512_and_si512(_mm512_madd52lo_epu64(zero, t0, m->n_inv), mask);
+
+    t0 = _mm512_madd52lo_epu64(t0, q, m->n0);
+    t1 = _mm512_madd52lo_epu64(_mm512_madd52hi_epu64(t1, q, m->n0), q, m->n1);
+    t2 = _mm512_madd52hi_epu64(t2, q, m->n1);
+
+    t1 = _mm512_add_epi64(t1, _mm512_srli_epi64(t0, 52));
+    t2 = _mm512_add_epi64(t2, _mm512_srli_epi64(t1, 52));
+
+    // a high limb of more than 12 bits is a result of 2^64 or more, above n
+    __m512i r = _mm512_or_si512(_mm512_and_si512(t1, mask), _mm512_slli_epi64(t2, 52));
+    __mmask8 above = _mm512_test_epi64_mask(t2, _mm512_set1_epi64(~0xFFFULL)) | _mm512_cmpge_epu64_mask(r, m->n);
+
+    return _mm512_mask_sub_epi64(r, above, r, m->n);
+}
+
+// 2 x mod n on the lanes of `lanes`, x elsewhere
+__attribute__((target("avx512f")))
+static inline __m512i mod_double_ifma(__m512i x, __m512i n, __mmask8 lanes) {
+
+    __m512i y = _mm512_add_epi64(x, x);
+    __mmask8 above = _mm512_cmplt_epu64_mask(y, x) | _mm512_cmpge_epu64_mask(y, n);
+
+    return _mm512_mask_mov_epi64(x, lanes, _mm512_mask_sub_epi64(y, above, y, n));
+}
+
+__attribute__((target("avx512f")))
+static inline __m512i mod_sub_ifma(__m512i x, __m512i y, __m512i n) {
+
+    __m512i d = _mm512_sub_epi64(x, y);
+    return _mm512_mask_add_epi64(d, _mm512_cmplt_epu64_mask(x, y), d, n);
+}
+
+// x R mod n to x R' mod n: R' = 2^40 R
+__attribute__((target("avx512f")))
+static inline __m512i to_ifma_form(__m512i x, __m512i n) {
+
+    for (int k = 0; k < 40; k ++) x = mod_double_ifma(x, n, 0xFF);
+
+    return x;
+}
+
+// The modulus, d, s and the bit length of d of 8 lanes, and R' mod n. `longest` and `most_s` are raised
+// to the largest bit length of d and the largest s
+__attribute__((target("avx512f")))
+static void load_ifma(const PrimeLane * lanes, IfmaModulus * m, __m512i * one, __m512i * d, __m512i * s,
+                      __m512i * bits, int * longest, int * most_s) {
+
+    uint64_t n[8], n_inv[8], r[8], dl[8], sl[8], bl[8];
+
+    for (int l = 0; l < 8; l ++) {
+        n[l] = lanes[l].m.n;
+        n_inv[l] = -lanes[l].m.n_inv & LIMB_MASK;
+        r[l] = lanes[l].m.one;
+        dl[l] = lanes[l].d;
+        sl[l] = lanes[l].s;
+        bl[l] = 64 - __builtin_clzll(lanes[l].d);
+        if ((int) bl[l] > *longest) *longest = bl[l];
+        if (lanes[l].s > *most_s) *most_s = lanes[l].s;
+    }
+
+    m->n = _mm512_loadu_si512(n);
+    m->n0 = _mm512_and_si512(m->n, _mm512_set1_epi64(LIMB_MASK));
+    m->n1 = _mm512_srli_epi64(m->n, 52);
+    m->n_inv = _mm512_loadu_si512(n_inv);
+    *one = to_ifma_form(_mm512_loadu_si512(r), m->n);
+    *d = _mm512_loadu_si512(dl);
+    *s = _mm512_loadu_si512(sl);
+    *bits = _mm512_loadu_si512(bl);
+}
+
+static inline void store_pass(__mmask8 mask, bool * pass) {
+    for (int l = 0; l < 8; l ++) pass[l] = (mask >> l) & 1;
+}
+
+// mr_pow2_lanes and mr_round_passes on IFMA_LANES lanes
+__attribute__((target("avx512f,avx512ifma")))
+static void mr_pow2_ifma(const PrimeLane * lanes, bool * pass) {
+
+    IfmaModulus m[IFMA_VECTORS];
+    __m512i one[IFMA_VECTORS], d[IFMA_VECTORS], s[IFMA_VECTORS], bits[IFMA_VECTORS], x[IFMA_VECTORS];
+    int longest = 0, most_s = 0;
+
+    for (int v = 0; v < IFMA_VECTORS; v ++) {
+        load_ifma(lanes + 8 * v, &m[v], &one[v], &d[v], &s[v], &bits[v], &longest, &most_s);
+        x[v] = mod_double_ifma(one[v], m[v].n, 0xFF);                  // the top bit of d
+    }
+
+    for (int step = longest - 2; step >= 0; step --) {
+
+        __m512i shift = _mm512_set1_epi64(step);
+
+        for (int v = 0; v < IFMA_VECTORS; v ++) {
+
+            __mmask8 busy = _mm512_cmpgt_epi64_mask(bits[v], _mm512_set1_epi64(step + 1));
+            __mmask8 bit = _mm512_test_epi64_mask(_mm512_srlv_epi64(d[v], shift), _mm512_set1_epi64(1));
+            __m512i y = mod_double_ifma(mont_mul_ifma(&m[v], x[v], x[v]), m[v].n, bit);
+
+            x[v] = _mm512_mask_mov_epi64(x[v], busy, y);
+        }
+    }
+
+    for (int v = 0; v < IFMA_VECTORS; v ++) {
+
+        __m512i minus_one = _mm512_sub_epi64(m[v].n, one[v]);
+        __mmask8 passed = _mm512_cmpeq_epi64_mask(x[v], one[v]) | _mm512_cmpeq_epi64_mask(x[v], minus_one);
+
+        // once at 1, the squares never reach -1
+        for (int r = 1; r < most_s; r ++) {
+            x[v] = mont_mul_ifma(&m[v], x[v], x[v]);
+            __mmask8 in_range = _mm512_cmpgt_epi64_mask(s[v], _mm512_set1_epi64(r));
+            passed |= _mm512_cmpeq_epi64_mask(x[v], minus_one) & in_range;
+        }
+
+        store_pass(passed, pass + 8 * v);
+    }
+}
+
+// lucas_lanes on IFMA_LANES lanes
+__attribute__((target("avx512f,avx512ifma")))
+static void lucas_ifma(const PrimeLane * lanes, bool * pass) {
+
+    IfmaModulus m[IFMA_VECTORS];
+    __m512i one[IFMA_VECTORS], d[IFMA_VECTORS], s[IFMA_VECTORS], bits[IFMA_VECTORS], q[IFMA_VECTORS];
+    __m512i v0[IFMA_VECTORS], v1[IFMA_VECTORS], qk[IFMA_VECTORS];
+    int longest = 0, most_s = 0;
+
+    for (int v = 0; v < IFMA_VECTORS; v ++) {
+
+        uint64_t ql[8];
+        for (int l = 0; l < 8; l ++) ql[l] = lanes[8 * v + l].q;
+
+        load_ifma(lanes + 8 * v, &m[v], &one[v], &d[v], &s[v], &bits[v], &longest, &most_s);
+        q[v] = to_ifma_form(_mm512_loadu_si512(ql), m[v].n);
+        v0[v] = mod_double_ifma(one[v], m[v].n, 0xFF);
+        v1[v] = qk[v] = one[v];
+    }
+
+    for (int step = longest - 1; step >= 0; step --) {
+
+        __m512i shift = _mm512_set1_epi64(step);
+
+        for (int v = 0; v < IFMA_VECTORS; v ++) {
+
+            __mmask8 bit = _mm512_test_epi64_mask(_mm512_srlv_epi64(d[v], shift), _mm512_set1_epi64(1));
+
+            __m512i qk1 = mont_mul_ifma(&m[v], qk[v], q[v]);
+            __m512i q_sel = _mm512_mask_mov_epi64(qk[v], bit, qk1);
+            __m512i v_sel = _mm512_mask_mov_epi64(v0[v], bit, v1[v]);
+
+            __m512i cross = mod_sub_ifma(mont_mul_ifma(&m[v], v0[v], v1[v]), qk[v], m[v].n);
+            __m512i square = mod_sub_ifma(mont_mul_ifma(&m[v], v_sel, v_sel),
+                                          mod_double_ifma(q_sel, m[v].n, 0xFF), m[v].n);
+
+            v0[v] = _mm512_mask_mov_epi64(square, bit, cross);
+            v1[v] = _mm512_mask_mov_epi64(cross, bit, square);
+            qk[v] = mont_mul_ifma(&m[v], qk[v], q_sel);
+        }
+    }
+
+    for (int v = 0; v < IFMA_VECTORS; v ++) {
+
+        __mmask8 passed = _mm512_cmpeq_epi64_mask(mod_double_ifma(v1[v], m[v].n, 0xFF), v0[v]);
+
+        for (int r = 0; r < most_s; r ++) {
+
+            __mmask8 zero = _mm512_cmpeq_epi64_mask(v0[v], _mm512_setzero_si512());
+            passed |= zero & _mm512_cmpgt_epi64_mask(s[v], _mm512_set1_epi64(r));
+
+            v0[v] = mod_sub_ifma(mont_mul_ifma(&m[v], v0[v], v0[v]), mod_double_ifma(qk[v], m[v].n, 0xFF), m[v].n);
+            qk[v] = mont_mul_ifma(&m[v], qk[v], qk[v]);
+        }
+
+        store_pass(passed, pass + 8 * v);
+    }
+}
+
+static bool ifma_supported() {
+    return __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+}
+
+#endif
+
+// Apply a test to the `count` lanes and keep only the ones that pass it. With `ifma`, the lanes go through
+// the IFMA tests IFMA_LANES at a time, and the last ones through the scalar tests, MR_LANES at a time
+static int lanes_filter(PrimeLane * lanes, int count, bool lucas, bool ifma) {
+
+    int kept = 0, start = 0;
+
+#ifdef PRIME_IFMA
+    for (; ifma && start + IFMA_LANES <= count; start += IFMA_LANES) {
+
+        bool pass[IFMA_LANES];
+
+        if (lucas) {
+            lucas_ifma(lanes + start, pass);
+        } else {
+            mr_pow2_ifma(lanes + start, pass);
+        }
+
+        for (int l = 0; l < IFMA_LANES; l ++) {
+            if (pass[l]) lanes[kept ++] = lanes[start + l];
+        }
+    }
+#else
+    (void) ifma;
+#endif
+
+    for (; start < count; start += MR_LANES) {
+
+        int n = count - start < MR_LANES ? count - start : MR_LANES;
+        bool pass[MR_LANES];
+
+        // the last group is padded with copies of its first lane
+        for (int l = n; l < MR_LANES; l ++) lanes[start + l] = lanes[start];
+
+        if (lucas) {
+            lucas_lanes(lanes + start, pass);
+        } else {
+
+            uint64_t x[MR_LANES];
+            mr_pow2_lanes(lanes + start, x);
+
+            for (int l = 0; l < MR_LANES; l ++) {
+                pass[l] = mr_round_passes(&lanes[start + l].m, x[l], lanes[start + l].s);
+            }
+        }
+
+        for (int l = 0; l < n; l ++) {
+            if (pass[l]) lanes[kept ++] = lanes[start + l];
+        }
+    }
+
+    return kept;
+}
+
+#define MR_BATCH 4096               // candidates that go through the tests together, enough to fill IFMA_LANES
+
+// prime[k] = is_prime(n[k]) for k < count
+void is_prime_batch(const uint64_t * n, bool * prime, size_t count) {
+
+    PrimeLane * lanes = (PrimeLane *) malloc(sizeof(PrimeLane) * (MR_BATCH + MR_LANES));
+    bool ifma = false;
+
+#ifdef PRIME_IFMA
+    ifma = ifma_supported();
+#endif
+
+    for (size_t start = 0; start < count; start += MR_BATCH) {
+
+        size_t end = count - start < MR_BATCH ? count : start + MR_BATCH;
+        int num_lanes = 0;
+
+        for (size_t k = start; k < end; k ++) {
+
+            int t = trial_division(n[k]);
+
+            if (t >= 0) {
+                prime[k] = t;
+                continue;
+            }
+
+            PrimeLane * lane = &lanes[num_lanes ++];
+
+            lane->index = k;
+            lane->m = (Montgomery) {.n = n[k], .n_inv = montgomery_inverse(n[k]), .one = -n[k] % n[k]};
+            lane->s = __builtin_ctzll(n[k] - 1);
+            lane->d = (n[k] - 1) >> lane->s;
+            prime[k] = false;
+        }
+
+        // most composites fail the base 2, the Lucas test mostly runs on primes
+        num_lanes = lanes_filter(lanes, num_lanes, false, ifma);
+
+        int kept = 0;
+
+        for (int l = 0; l < num_lanes; l ++) {
+            if ( lucas_setup(&lanes[l]) ) lanes[kept ++] = lanes[l];
+        }
+
+        num_lanes = lanes_filter(lanes, kept, true, ifma);
+
+        for (int l = 0; l < num_lanes; l ++) {
+            prime[lanes[l].index] = true;
+        }
+    }
+
+    free(lanes);
+}
+
+#endif
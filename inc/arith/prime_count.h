@@ -0,0 +1,441 @@
+#ifndef ARITH_PRIME_COUNT
+#define ARITH_PRIME_COUNT
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "sieve.h"
+
+// The prime-counting function pi(x) by the method of Meissel and Lehmer.
+//
+// Let phi(x, a) be the number of integers in [1, x] that none of the first a primes divides. With
+// y = x^(1/3) and a = pi(y), the integers of [1, x] without a prime factor up to y are 1, the primes in
+// (y, x] and the products of two such primes p <= q, so that
+//
+//      pi(x) = phi(x, a) + a - 1 - P2(x, a)
+//      P2(x, a) = sum over y < p <= sqrt(x) of pi(x / p) - pi(p) + 1
+//
+// phi follows the recurrence phi(x, a) = phi(x, a - 1) - phi(x / p_a, a - 1), cut short when:
+//  - a <= PHI_TINY_A, phi(x, a) being periodic with period 2 * 3 * 5 * 7 * 11 * 13;
+//  - x < p_(a + 1)^2, in which case phi(x, a) = pi(x) - a + 1, read from a table of pi;
+//  - x / p_i < p_i, all the remaining terms being 1;
+//  - a <= PHI_CACHE_A and x < PHI_CACHE_X, phi(x, a) being read from the sieve of [1, PHI_CACHE_X) by the
+//    first a primes, which is kept for every a: most of the leaves of the recursion fall there. The cache
+//    is smaller for a small x, for which it would cost more to build than it saves.
+// The terms of the outermost sum are shared between threads.
+//
+// P2 needs pi(x / p) for x / p up to x^(2/3): [0, x^(2/3)] is sieved in chunks (sieve.h) shared between
+// threads, every chunk counting its primes up to the values x / p that fall in it. The counts of the
+// chunks are then added up in order.
+
+#define PHI_TINY_A 6
+#define PHI_TINY_PERIOD 30030       // 2 * 3 * 5 * 7 * 11 * 13
+#define PHI_CACHE_A 100
+#define PHI_CACHE_X (1 << 20)
+
+/**========================================================================
+ *                           Table of pi
+ *========================================================================**/
+
+// pi(n) for n <= limit: a bit per odd number, and the number of primes before every word of bits. The
+// same layout holds the numbers left by the first a primes for the cache of phi
+typedef struct PiTable {
+
+    uint64_t limit;
+    uint64_t * bits;            // bit n % 128 / 2 of bits[n / 128] set iff the odd n is prime
+    uint32_t * counts;          // primes below 128 k
+
+} PiTable;
+
+void pi_table_init(PiTable * t, uint64_t limit, const uint32_t * primes, uint32_t num_primes) {
+
+    uint64_t words = limit / 128 + 1;
+
+    t->limit = limit;
+    t->bits = (uint64_t *) calloc(words, sizeof(uint64_t));
+    t->counts = (uint32_t *) malloc(sizeof(uint32_t) * words);
+
+    for (uint32_t k = 1; k < num_primes && primes[k] <= limit; k ++) { // 2 is counted apart
+        t->bits[primes[k] / 128] |= 1ULL << (primes[k] % 128 / 2);
+    }
+
+    uint32_t count = limit >= 2;
+
+    for (uint64_t w = 0; w < words; w ++) {
+        t->counts[w] = count;
+        count += __builtin_popcountll(t->bits[w]);
+    }
+}
+
+void pi_table_free(PiTable * t) {
+
+    free(t->bits);
+    free(t->counts);
+}
+
+// Bits set up to n, plus the count before the word of n
+static inline uint64_t table_lookup(const PiTable * t, uint64_t n) {
+
+    uint64_t below = (n % 128 + 1) / 2;                 // odd numbers of the word up to n
+    uint64_t mask = below == 64 ? UINT64_MAX : (1ULL << below) - 1;
+
+    return t->counts[n / 128] + __builtin_popcountll(t->bits[n / 128] & mask);
+}
+
+static inline uint64_t pi_lookup(const PiTable * t, uint64_t n) {
+    return n < 2 ? 0 : table_lookup(t, n);
+}
+
+/**========================================================================
+ *                           phi(x, a)
+ *========================================================================**/
+
+typedef struct PhiContext {
+
+    const uint32_t * primes;    // primes[1] = 2, primes[2] = 3, ...
+    uint32_t num_primes;        // primes[num_primes] is the last one
+    const PiTable * pi;
+    PiTable * cache;            // cache[a] for PHI_TINY_A < a <= cache_a, the numbers of [1, cache_x) left by the first a primes
+    int cache_a;
+    uint64_t cache_x;
+    uint16_t tiny[PHI_TINY_A + 1][PHI_TINY_PERIOD];   // phi(r, a) for r < the product of the first a primes
+    uint32_t tiny_period[PHI_TINY_A + 1];
+
+} PhiContext;
+
+// `x` and `a` tell the size of the cache
+void phi_context_init(PhiContext * c, const uint32_t * primes, uint32_t num_primes, const PiTable * pi, uint64_t x, int a) {
+
+    c->primes = primes;
+    c->num_primes = num_primes;
+    c->pi = pi;
+
+    uint32_t period = 1;
+
+    for (int a = 0; a <= PHI_TINY_A; a ++) {
+
+        if (a > 0) period *= primes[a];
+        c->tiny_period[a] = period;
+
+        uint32_t count = 0;
+
+        for (uint32_t r = 0; r < period; r ++) {
+
+            bool coprime = r > 0;
+            for (int k = 1; k <= a && coprime; k ++) coprime = r % primes[k] != 0;
+
+            count += coprime;
+            c->tiny[a][r] = count;
+        }
+    }
+
+    // the odd numbers left by the first a primes, from those left by the first a - 1
+    uint64_t sqrt_x = isqrt_u64(x);
+
+    c->cache_a = a < PHI_CACHE_A ? a : PHI_CACHE_A;
+    c->cache_x = sqrt_x < PHI_CACHE_X ? (sqrt_x / 128 + 1) * 128 : PHI_CACHE_X;
+    c->cache = (PiTable *) calloc(c->cache_a + 1, sizeof(PiTable));
+
+    uint64_t words = c->cache_x / 128;
+    uint64_t * bits = (uint64_t *) malloc(sizeof(uint64_t) * words);
+
+    memset(bits, 0xFF, sizeof(uint64_t) * words);
+
+    for (int a = 2; a <= c->cache_a; a ++) {
+
+        for (uint64_t m = primes[a]; m < c->cache_x; m += 2 * primes[a]) {
+            bits[m / 128] &= ~(1ULL << (m % 128 / 2));
+        }
+
+        if (a <= PHI_TINY_A) continue;
+
+        PiTable * t = &c->cache[a];
+
+        t->limit = c->cache_x - 1;
+        t->bits = (uint64_t *) malloc(sizeof(uint64_t) * words);
+        t->counts = (uint32_t *) malloc(sizeof(uint32_t) * words);
+        memcpy(t->bits, bits, sizeof(uint64_t) * words);
+
+        uint32_t count = 0;
+
+        for (uint64_t w = 0; w < words; w ++) {
+            t->counts[w] = count;
+            count += __builtin_popcountll(t->bits[w]);
+        }
+    }
+
+    free(bits);
+}
+
+void phi_context_free(PhiContext * c) {
+
+    for (int a = PHI_TINY_A + 1; a <= c->cache_a; a ++) pi_table_free(&c->cache[a]);
+    free(c->cache);
+}
+
+static inline int64_t phi_tiny(const PhiContext * c, uint64_t x, int a) {
+
+    uint64_t period = c->tiny_period[a];
+    return (x / period) * c->tiny[a][period - 1] + c->tiny[a][x % period];
+}
+
+int64_t phi(const PhiContext * c, uint64_t x, int a) {
+
+    if (a <= PHI_TINY_A) return phi_tiny(c, x, a);
+    if (x < c->primes[a + 1]) return x >= 1;
+
+    uint64_t next = c->primes[a + 1];
+
+    if (x <= c->pi->limit && x < next * next) return pi_lookup(c->pi, x) - a + 1;
+    if (a <= c->cache_a && x < c->cache_x) return table_lookup(&c->cache[a], x);
+
+    int64_t sum = phi_tiny(c, x, PHI_TINY_A);
+
+    for (int i = PHI_TINY_A + 1; i <= a; i ++) {
+
+        uint64_t xp = x / c->primes[i];
+
+        if (xp < c->primes[i]) {
+            sum -= a - i + 1;
+            break;
+        }
+
+        sum -= phi(c, xp, i - 1);
+    }
+
+    return sum;
+}
+
+/**========================================================================
+ *                           Threads
+ *========================================================================**/
+
+typedef struct PrimeCountJob {
+
+    uint64_t x;
+    int a;
+    const PhiContext * phi;
+    int next_term;              // next term of the outermost sum of phi
+    int64_t phi_sum;
+
+    // P2
+    SieveBase base;
+    const uint64_t * queries;   // x / p for the primes of (y, sqrt(x)], increasing
+    uint64_t * query_counts;    // primes of the chunk up to each query, then pi of the query
+    uint64_t num_queries;
+    uint64_t * chunk_counts;
+    uint64_t num_chunks;
+    uint64_t next_chunk;
+
+} PrimeCountJob;
+
+void * phi_thread(void * arg) {
+
+    PrimeCountJob * job = (PrimeCountJob *) arg;
+    const PhiContext * c = job->phi;
+    int64_t sum = 0;
+
+    while (true) {
+
+        int i = __atomic_fetch_add(&job->next_term, 1, __ATOMIC_RELAXED);
+        if (i > job->a) break;
+
+        uint64_t xp = job->x / c->primes[i];
+
+        if (xp < c->primes[i]) {
+            sum -= 1;
+            continue;
+        }
+
+        sum -= phi(c, xp, i - 1);
+    }
+
+    __atomic_fetch_add(&job->phi_sum, sum, __ATOMIC_RELAXED);
+
+    return NULL;
+}
+
+// Primes of the segment of `w` up to n, n being in the segment. `byte` and `below` carry the primes before
+// a byte from one call to the next, so that increasing values of n only scan the segment once
+static uint64_t segment_count_upto(const SieveWorker * w, uint64_t n, uint64_t * byte, uint64_t * below) {
+
+    uint64_t last = n / 30 - w->lo;     // byte of n in the segment
+    uint64_t count = 0;
+
+    for (; *byte < last; (*byte) ++) *below += __builtin_popcount(w->segment[*byte]);
+
+    for (int k = 0; k < 8; k ++) {
+        if ( 30 * (n / 30) + WHEEL_RESIDUES[k] <= n ) count += (w->segment[last] >> k) & 1;
+    }
+
+    return *below + count;
+}
+
+void * p2_thread(void * arg) {
+
+    PrimeCountJob * job = (PrimeCountJob *) arg;
+    SieveWorker w;
+    uint64_t total_bytes = job->base.limit / 30 + 1;
+
+    sieve_worker_init(&w, &job->base);
+
+    while (true) {
+
+        uint64_t c = __atomic_fetch_add(&job->next_chunk, 1, __ATOMIC_RELAXED);
+        if (c >= job->num_chunks) break;
+
+        uint64_t lo = c * SIEVE_CHUNK_BYTES;
+        uint64_t end = lo + SIEVE_CHUNK_BYTES < total_bytes ? lo + SIEVE_CHUNK_BYTES : total_bytes;
+
+        // the queries of the chunk
+        uint64_t q = 0, hi = job->num_queries;
+
+        while (q < hi) { // first query >= 30 lo
+            uint64_t mid = (q + hi) / 2;
+            if (job->queries[mid] < 30 * lo) q = mid + 1;
+            else hi = mid;
+        }
+
+        uint64_t count = 0;
+
+        sieve_worker_seek(&w, lo);
+
+        while (w.lo + w.bytes < end) {
+
+            sieve_worker_next(&w, end - w.lo - w.bytes);
+
+            uint64_t byte = 0, below = 0;
+
+            for (; q < job->num_queries && job->queries[q] < 30 * (w.lo + w.bytes); q ++) {
+                job->query_counts[q] = count + segment_count_upto(&w, job->queries[q], &byte, &below);
+            }
+
+            count += sieve_segment_count(&w);
+        }
+
+        job->chunk_counts[c] = count;
+    }
+
+    sieve_worker_free(&w);
+
+    return NULL;
+}
+
+static void run_threads(void * (*work)(void *), PrimeCountJob * job, int num_threads) {
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+
+    for (int t = 0; t < num_threads; t ++) pthread_create(&threads[t], NULL, work, job);
+    for (int t = 0; t < num_threads; t ++) pthread_join(threads[t], NULL);
+
+    free(threads);
+}
+
+/**========================================================================
+ *                           pi(x)
+ *========================================================================**/
+
+static uint64_t icbrt_u64(uint64_t n) {
+
+    uint64_t r = (uint64_t) cbrt((double) n);
+
+    while (r > 0 && r * r * r > n) r --;
+    while ((r + 1) * (r + 1) * (r + 1) <= n) r ++;
+
+    return r;
+}
+
+uint64_t prime_count(uint64_t x, int num_threads) {
+
+    if (x < 2) return 0;
+
+    uint64_t y = icbrt_u64(x), sqrt_x = isqrt_u64(x);
+
+    // primes up to sqrt(x), and a few more so that p_(a + 1) always exists
+    uint32_t num_primes = 0;
+    uint32_t * sieved = small_primes(sqrt_x + 64, &num_primes);
+    uint32_t * primes = (uint32_t *) malloc(sizeof(uint32_t) * (num_primes + 1));
+
+    primes[0] = 0;
+    memcpy(primes + 1, sieved, sizeof(uint32_t) * num_primes);
+    free(sieved);
+
+    if (x <= sqrt_x + 64) { // all the primes are already there
+        uint64_t count = 0;
+        while (count < num_primes && primes[count + 1] <= x) count ++;
+        free(primes);
+        return count;
+    }
+
+    PiTable pi;
+    pi_table_init(&pi, sqrt_x, primes + 1, num_primes);
+
+    PrimeCountJob job = {.x = x, .a = (int) pi_lookup(&pi, y)};
+    PhiContext * phi_context = (PhiContext *) malloc(sizeof(PhiContext));
+
+    phi_context_init(phi_context, primes, num_primes, &pi, x, job.a);
+    job.phi = phi_context;
+
+    // phi(x, a), its outermost sum shared between threads
+    if (job.a <= PHI_TINY_A) {
+        job.phi_sum = phi_tiny(phi_context, x, job.a);
+    } else {
+        job.phi_sum = phi_tiny(phi_context, x, PHI_TINY_A);
+        job.next_term = PHI_TINY_A + 1;
+        run_threads(phi_thread, &job, num_threads);
+    }
+
+    // P2: pi(x / p) for the primes y < p <= sqrt(x), by a sieve up to x / y
+    uint64_t first = job.a + 1, last = pi_lookup(&pi, sqrt_x);
+    int64_t p2 = 0;
+
+    if (first <= last) {
+
+        job.num_queries = last - first + 1;
+
+        uint64_t * queries = (uint64_t *) malloc(sizeof(uint64_t) * job.num_queries);
+        for (uint64_t k = 0; k < job.num_queries; k ++) queries[k] = x / primes[last - k];
+
+        sieve_base_init(&job.base, queries[job.num_queries - 1]);
+
+        job.queries = queries;
+        job.query_counts = (uint64_t *) calloc(job.num_queries, sizeof(uint64_t));
+        job.num_chunks = (job.base.limit / 30 + 1 + SIEVE_CHUNK_BYTES - 1) / SIEVE_CHUNK_BYTES;
+        job.chunk_counts = (uint64_t *) calloc(job.num_chunks, sizeof(uint64_t));
+
+        run_threads(p2_thread, &job, num_threads);
+
+        // pi(x / p) = 2, 3 and 5, the primes of the chunks before, and the ones of its chunk up to x / p
+        uint64_t before = 3, q = 0;
+
+        for (uint64_t c = 0; c < job.num_chunks; c ++) {
+
+            uint64_t end = 30 * (c + 1) * SIEVE_CHUNK_BYTES;
+
+            for (; q < job.num_queries && queries[q] < end; q ++) {
+                uint64_t k = job.num_queries - 1 - q;        // p = primes[first + k]
+                p2 += (int64_t) (before + job.query_counts[q]) - (int64_t) (first + k) + 1;
+            }
+
+            before += job.chunk_counts[c];
+        }
+
+        free(queries);
+        free(job.query_counts);
+        free(job.chunk_counts);
+        sieve_base_free(&job.base);
+    }
+
+    uint64_t count = job.phi_sum + job.a - 1 - p2;
+
+    pi_table_free(&pi);
+    phi_context_free(phi_context);
+    free(phi_context);
+    free(primes);
+
+    return count;
+}
+
+#endif
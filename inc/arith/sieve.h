@@ -0,0 +1,502 @@
+#ifndef ARITH_SIEVE
+#define ARITH_SIEVE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+// Segmented sieve of Eratosthenes.
+//
+// Only the numbers coprime to 30 can be prime (besides 2, 3 and 5), and there are 8 of them in every 30
+// consecutive numbers: 30i + 1, 30i + 7, ..., 30i + 29. A byte holds the 8 of them, so that byte i of the
+// sieve stands for [30i, 30i + 30) and a segment of SIEVE_SEGMENT_BYTES bytes for 30 times as many numbers.
+// Segments are small enough to stay in cache while every prime up to sqrt(limit) crosses off its
+// multiples in them.
+//
+// A prime p only crosses off p * m for m coprime to 30, and going from one such m to the next moves by a
+// number of bytes that only depends on p / 30, p % 30 and the position of m on the wheel (WHEEL_STEPS):
+// each sieving prime keeps its next multiple and its position on the wheel from one segment to the next.
+// The multiples of 7, 11, 13 and 17 repeat every 7 * 11 * 13 * 17 bytes: rather than crossed off, they are
+// copied into every segment from a pattern, which saves a fifth of the crossings.
+//
+// sieve_primes splits [0, limit] in chunks of SIEVE_CHUNK_SEGMENTS segments shared between threads. The
+// primes of every chunk are written to a text buffer, and the chunks are written out in order by the
+// calling thread as soon as they are complete: the primes come out sorted whatever the number of threads.
+
+#define SIEVE_SEGMENT_BYTES (1 << 17)           // 3932160 numbers
+#define SIEVE_CHUNK_SEGMENTS 4
+#define SIEVE_CHUNK_BYTES ((uint64_t) SIEVE_SEGMENT_BYTES * SIEVE_CHUNK_SEGMENTS)
+#define PRESIEVE_BYTES (7 * 11 * 13 * 17)
+#define PRESIEVE_MAX 17                         // largest prime of the pattern
+
+const uint8_t WHEEL_RESIDUES[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+const uint8_t WHEEL_GAPS[8] = {6, 4, 2, 4, 2, 4, 6, 2};       // WHEEL_RESIDUES[k + 1] - WHEEL_RESIDUES[k], modulo 30
+
+typedef struct WheelStep {
+
+    uint8_t mask;               // bit of p * m cleared, ~(1 << bit)
+    uint8_t extra;              // bytes to add to (p / 30) * WHEEL_GAPS[k] to reach the next multiple
+
+} WheelStep;
+
+// WHEEL_STEPS[c][k] for a prime p = 30a + WHEEL_RESIDUES[c] and a multiple p * m with m % 30 = WHEEL_RESIDUES[k]
+WheelStep WHEEL_STEPS[8][8];
+int8_t WHEEL_BIT[30];           // bit of each residue modulo 30, -1 for the ones that aren't coprime to 30
+bool WHEEL_READY = false;
+
+void init_wheel() {
+
+    if (WHEEL_READY) return;
+
+    memset(WHEEL_BIT, -1, sizeof(WHEEL_BIT));
+    for (int k = 0; k < 8; k ++) WHEEL_BIT[WHEEL_RESIDUES[k]] = k;
+
+    for (int c = 0; c < 8; c ++) {
+        for (int k = 0; k < 8; k ++) {
+
+            int s = WHEEL_RESIDUES[c], r = WHEEL_RESIDUES[k];
+
+            WHEEL_STEPS[c][k].mask = ~(1 << WHEEL_BIT[(s * r) % 30]);
+            WHEEL_STEPS[c][k].extra = s * (r + WHEEL_GAPS[k]) / 30 - s * r / 30;
+        }
+    }
+
+    WHEEL_READY = true;
+}
+
+/**========================================================================
+ *                           Sieving primes
+ *========================================================================**/
+
+static uint64_t isqrt_u64(uint64_t n) {
+
+    uint64_t r = (uint64_t) sqrt((double) n);
+
+    while (r * r > n) r --;
+    while ((r + 1) * (r + 1) <= n) r ++;
+
+    return r;
+}
+
+// The primes up to `limit` by a plain sieve of Eratosthenes, to be freed by the caller
+uint32_t * small_primes(uint32_t limit, uint32_t * count) {
+
+    uint8_t * composite = (uint8_t *) calloc((size_t) limit + 1, 1);
+    uint32_t * primes = (uint32_t *) malloc(sizeof(uint32_t) * (limit / 2 + 2));
+    uint32_t n = 0;
+
+    for (uint64_t p = 2; p <= limit; p ++) {
+
+        if (composite[p]) continue;
+
+        primes[n ++] = p;
+
+        for (uint64_t q = p * p; q <= limit; q += p) composite[q] = 1;
+    }
+
+    free(composite);
+    *count = n;
+
+    return primes;
+}
+
+typedef struct SievePrime {
+
+    uint32_t prime;
+    uint8_t wheel_class;        // index of prime % 30 in WHEEL_RESIDUES
+    uint8_t k;                  // index of m % 30 in WHEEL_RESIDUES for the next multiple p * m
+    uint64_t next;              // byte of the next multiple
+
+} SievePrime;
+
+// The primes past PRESIEVE_MAX up to sqrt(limit) and the pattern of the smaller ones, shared by every worker
+typedef struct SieveBase {
+
+    uint64_t limit;
+    uint32_t * primes;
+    uint32_t count;
+    uint8_t * pattern;          // PRESIEVE_BYTES bytes, the multiples of 7, 11, 13 and 17 crossed off
+
+} SieveBase;
+
+void sieve_base_init(SieveBase * base, uint64_t limit) {
+
+    init_wheel();
+
+    uint32_t count = 0;
+    uint32_t * primes = small_primes((uint32_t) isqrt_u64(limit), &count);
+    uint32_t skip = 0;
+
+    while (skip < count && primes[skip] <= PRESIEVE_MAX) skip ++;
+
+    base->limit = limit;
+    base->count = count - skip;
+    base->primes = (uint32_t *) malloc(sizeof(uint32_t) * (base->count + 1));
+    memcpy(base->primes, primes + skip, sizeof(uint32_t) * base->count);
+
+    free(primes);
+
+    base->pattern = (uint8_t *) malloc(PRESIEVE_BYTES);
+    memset(base->pattern, 0xFF, PRESIEVE_BYTES);
+
+    for (int n = 1; n < 30 * PRESIEVE_BYTES; n += 2) {
+        if (WHEEL_BIT[n % 30] >= 0 && (n % 7 == 0 || n % 11 == 0 || n % 13 == 0 || n % 17 == 0)) {
+            base->pattern[n / 30] &= ~(1 << WHEEL_BIT[n % 30]);
+        }
+    }
+}
+
+void sieve_base_free(SieveBase * base) {
+
+    free(base->primes);
+    free(base->pattern);
+    base->primes = NULL;
+    base->pattern = NULL;
+    base->count = 0;
+}
+
+/**========================================================================
+ *                           Segments
+ *========================================================================**/
+
+// What a thread needs to sieve consecutive segments
+typedef struct SieveWorker {
+
+    const SieveBase * base;
+    SievePrime * primes;
+    uint8_t * segment;
+    uint64_t lo;                // first byte of `segment`
+    uint64_t bytes;             // bytes of `segment` in use
+
+} SieveWorker;
+
+void sieve_worker_init(SieveWorker * w, const SieveBase * base) {
+
+    w->base = base;
+    w->primes = (SievePrime *) malloc(sizeof(SievePrime) * (base->count + 1));
+    w->segment = (uint8_t *) malloc(SIEVE_SEGMENT_BYTES);
+    w->lo = w->bytes = 0;
+}
+
+void sieve_worker_free(SieveWorker * w) {
+
+    free(w->primes);
+    free(w->segment);
+}
+
+// Position every sieving prime on its first multiple p * m >= max(p^2, 30 lo) with m coprime to 30
+void sieve_worker_seek(SieveWorker * w, uint64_t lo) {
+
+    w->lo = lo;
+    w->bytes = 0;
+
+    for (uint32_t i = 0; i < w->base->count; i ++) {
+
+        uint64_t p = w->base->primes[i];
+        uint64_t m = (30 * lo + p - 1) / p;
+
+        if (m < p) m = p;
+
+        uint64_t q = m / 30;
+        int k = 0;
+
+        while (WHEEL_RESIDUES[k] < m % 30) k ++;    // m % 30 <= 29, the last residue
+
+        m = 30 * q + WHEEL_RESIDUES[k];
+
+        w->primes[i] = (SievePrime) {(uint32_t) p, (uint8_t) WHEEL_BIT[p % 30], (uint8_t) k, p * m / 30};
+    }
+}
+
+// Cross off a prime on [lo, end), leaving it on its first multiple past `end`
+static inline void sieve_cross_off(uint8_t * segment, uint64_t lo, uint64_t end, SievePrime * sp) {
+
+    const WheelStep * steps = WHEEL_STEPS[sp->wheel_class];
+    uint64_t a = sp->prime / 30;
+    uint64_t b = sp->next;
+    int k = sp->k;
+
+    // finish the turn of the wheel, then whole turns: m goes up by 30, so p * m by p bytes
+    while (k != 0 && b < end) {
+        segment[b - lo] &= steps[k].mask;
+        b += a * WHEEL_GAPS[k] + steps[k].extra;
+        k = (k + 1) & 7;
+    }
+
+    if (k == 0) {
+
+        uint64_t p = sp->prime;
+        uint64_t offsets[8];
+
+        offsets[0] = 0;
+        for (int j = 1; j < 8; j ++) offsets[j] = offsets[j - 1] + a * WHEEL_GAPS[j - 1] + steps[j - 1].extra;
+
+        for (; b + p <= end; b += p) {
+            uint8_t * s = segment + (b - lo);
+            s[0] &= steps[0].mask;
+            s[offsets[1]] &= steps[1].mask;
+            s[offsets[2]] &= steps[2].mask;
+            s[offsets[3]] &= steps[3].mask;
+            s[offsets[4]] &= steps[4].mask;
+            s[offsets[5]] &= steps[5].mask;
+            s[offsets[6]] &= steps[6].mask;
+            s[offsets[7]] &= steps[7].mask;
+        }
+
+        while (b < end) {
+            segment[b - lo] &= steps[k].mask;
+            b += a * WHEEL_GAPS[k] + steps[k].extra;
+            k = (k + 1) & 7;
+        }
+    }
+
+    sp->next = b;
+    sp->k = k;
+}
+
+// Sieve the segment that follows the previous one, at most `bytes` bytes. Bit k of segment[i] is then set
+// iff 30 (lo + i) + WHEEL_RESIDUES[k] is a prime, except for the numbers past the limit
+void sieve_worker_next(SieveWorker * w, uint64_t bytes) {
+
+    w->lo += w->bytes;
+    w->bytes = bytes < SIEVE_SEGMENT_BYTES ? bytes : SIEVE_SEGMENT_BYTES;
+
+    uint64_t lo = w->lo, end = lo + w->bytes;
+
+    for (uint64_t i = 0; i < w->bytes; ) {
+
+        uint64_t offset = (lo + i) % PRESIEVE_BYTES;
+        uint64_t n = PRESIEVE_BYTES - offset < w->bytes - i ? PRESIEVE_BYTES - offset : w->bytes - i;
+
+        memcpy(w->segment + i, w->base->pattern + offset, n);
+        i += n;
+    }
+
+    // 1 isn't prime, 7, 11, 13 and 17 are
+    if (lo == 0) w->segment[0] = (w->segment[0] & ~1) | 0x1E;
+
+    for (uint32_t i = 0; i < w->base->count; i ++) {
+
+        SievePrime * sp = &w->primes[i];
+
+        if (sp->next < end) sieve_cross_off(w->segment, lo, end, sp);
+    }
+
+    // numbers past the limit
+    uint64_t limit = w->base->limit;
+
+    if (30 * end > limit) {
+
+        for (uint64_t b = limit / 30 < lo ? lo : limit / 30; b < end; b ++) {
+            for (int k = 0; k < 8; k ++) {
+                if (30 * b + WHEEL_RESIDUES[k] > limit) w->segment[b - lo] &= ~(1 << k);
+            }
+        }
+    }
+}
+
+uint64_t sieve_segment_count(const SieveWorker * w) {
+
+    uint64_t count = 0;
+    uint64_t k = 0;
+
+    for (; k + 8 <= w->bytes; k += 8) {
+        uint64_t word;
+        memcpy(&word, w->segment + k, 8);
+        count += __builtin_popcountll(word);
+    }
+
+    for (; k < w->bytes; k ++) count += __builtin_popcount(w->segment[k]);
+
+    return count;
+}
+
+/**========================================================================
+ *                           Ordered output
+ *========================================================================**/
+
+typedef struct SieveChunk {
+
+    uint64_t index;             // chunk in the slot, or UINT64_MAX when the slot is free
+    bool done;
+    uint64_t count;
+    char * text;
+    size_t len;
+    size_t cap;
+
+} SieveChunk;
+
+typedef struct SieveJob {
+
+    const SieveBase * base;
+    uint64_t num_chunks;
+    uint64_t next_chunk;        // next chunk to sieve
+    FILE * out;                 // NULL to only count
+
+    SieveChunk * slots;         // chunk c goes in slot c % num_slots
+    int num_slots;
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+
+    uint64_t count;
+
+} SieveJob;
+
+static void chunk_reserve(SieveChunk * chunk, size_t extra) {
+
+    if (chunk->len + extra <= chunk->cap) return;
+
+    chunk->cap = 2 * (chunk->len + extra);
+    chunk->text = (char *) realloc(chunk->text, chunk->cap);
+}
+
+// Append the decimal digits of x and a newline
+static inline char * write_u64(char * p, uint64_t x) {
+
+    char digits[20];
+    int n = 0;
+
+    do {
+        digits[n ++] = '0' + x % 10;
+        x /= 10;
+    } while (x);
+
+    while (n) *p ++ = digits[-- n];
+    *p ++ = '\n';
+
+    return p;
+}
+
+static void chunk_append_segment(SieveChunk * chunk, const SieveWorker * w, uint64_t count) {
+
+    chunk_reserve(chunk, count * 21);
+
+    char * p = chunk->text + chunk->len;
+
+    for (uint64_t i = 0; i < w->bytes; i ++) {
+        for (uint8_t bits = w->segment[i]; bits; bits &= bits - 1) {
+            p = write_u64(p, 30 * (w->lo + i) + WHEEL_RESIDUES[__builtin_ctz(bits)]);
+        }
+    }
+
+    chunk->len = p - chunk->text;
+}
+
+void * sieve_thread(void * arg) {
+
+    SieveJob * job = (SieveJob *) arg;
+    SieveWorker w;
+    uint64_t total_bytes = job->base->limit / 30 + 1;
+
+    sieve_worker_init(&w, job->base);
+
+    while (true) {
+
+        uint64_t c = __atomic_fetch_add(&job->next_chunk, 1, __ATOMIC_RELAXED);
+        if (c >= job->num_chunks) break;
+
+        SieveChunk * chunk = &job->slots[c % job->num_slots];
+
+        // wait for the writer to be done with the chunk that had the slot
+        pthread_mutex_lock(&job->lock);
+        while (chunk->index != UINT64_MAX) pthread_cond_wait(&job->changed, &job->lock);
+        chunk->index = c;
+        pthread_mutex_unlock(&job->lock);
+
+        chunk->count = 0;
+        chunk->len = 0;
+
+        uint64_t lo = c * SIEVE_CHUNK_BYTES;
+        uint64_t end = lo + SIEVE_CHUNK_BYTES < total_bytes ? lo + SIEVE_CHUNK_BYTES : total_bytes;
+
+        sieve_worker_seek(&w, lo);
+
+        while (w.lo + w.bytes < end) {
+
+            sieve_worker_next(&w, end - w.lo - w.bytes);
+
+            uint64_t count = sieve_segment_count(&w);
+
+            chunk->count += count;
+            if (job->out) chunk_append_segment(chunk, &w, count);
+        }
+
+        pthread_mutex_lock(&job->lock);
+        chunk->done = true;
+        pthread_cond_broadcast(&job->changed);
+        pthread_mutex_unlock(&job->lock);
+    }
+
+    sieve_worker_free(&w);
+
+    return NULL;
+}
+
+// The number of primes up to `limit`, written to `out` one per line in increasing order unless it is NULL
+uint64_t sieve_primes(uint64_t limit, int num_threads, FILE * out) {
+
+    SieveBase base;
+    sieve_base_init(&base, limit);
+
+    SieveJob job = {.base = &base, .num_chunks = (limit / 30 + 1 + SIEVE_CHUNK_BYTES - 1) / SIEVE_CHUNK_BYTES, .out = out};
+
+    job.num_slots = 2 * num_threads;
+    job.slots = (SieveChunk *) calloc(job.num_slots, sizeof(SieveChunk));
+    for (int s = 0; s < job.num_slots; s ++) job.slots[s].index = UINT64_MAX;
+
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_cond_init(&job.changed, NULL);
+
+    const uint64_t wheel_primes[3] = {2, 3, 5};
+
+    for (int k = 0; k < 3; k ++) {
+        if (wheel_primes[k] > limit) break;
+        job.count ++;
+        if (out) fprintf(out, "%llu\n", (unsigned long long) wheel_primes[k]);
+    }
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+
+    for (int t = 0; t < num_threads; t ++) {
+        pthread_create(&threads[t], NULL, sieve_thread, &job);
+    }
+
+    // write the chunks in order as they complete
+    for (uint64_t c = 0; c < job.num_chunks; c ++) {
+
+        SieveChunk * chunk = &job.slots[c % job.num_slots];
+
+        pthread_mutex_lock(&job.lock);
+        while (chunk->index != c || !chunk->done) pthread_cond_wait(&job.changed, &job.lock);
+        pthread_mutex_unlock(&job.lock);
+
+        job.count += chunk->count;
+        if (out) fwrite(chunk->text, 1, chunk->len, out);
+
+        pthread_mutex_lock(&job.lock);
+        chunk->index = UINT64_MAX;
+        chunk->done = false;
+        pthread_cond_broadcast(&job.changed);
+        pthread_mutex_unlock(&job.lock);
+    }
+
+    for (int t = 0; t < num_threads; t ++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    for (int s = 0; s < job.num_slots; s ++) free(job.slots[s].text);
+
+    free(job.slots);
+    free(threads);
+    pthread_mutex_destroy(&job.lock);
+    pthread_cond_destroy(&job.changed);
+    sieve_base_free(&base);
+
+    return job.count;
+}
+
+#endif
@@ -3,64 +3,192 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "battleship_board.h"
-#include "battleship_cli.h"
+#include "battleship_book.h"
+#include "battleship_engine.h"
+#include "battleship_rng.h"
+#include "battleship_density.h"
+#include "battleship_montecarlo.h"
+#include "battleship_sampler.h"
+#include "battleship_untried.h"
+#include "battleship_record.h"
+#include "battleship_timing.h"
+#include "battleship_transposition.h"
 #include "ejovo_rand.h"
 
 // Define all the functions needed by an enemy AI (artifical intelligence)
 
+typedef enum AIStrategy {
+
+    AI_RANDOM,          // fire at a random untried location
+    AI_DENSITY,         // fire at the untried location covered by the most placements (battleship_density.h)
+    AI_MONTE_CARLO,     // fire at the untried location covered by the most sampled fleets (battleship_montecarlo.h)
+
+} AIStrategy;
+
+const char * AI_STRATEGY_NAMES[] = {"random", "density", "montecarlo"};
+const int NUM_AI_STRATEGIES = 3;
+
 typedef struct AI {
 
     int last_i;
     int last_j;
     int last_direction;
     bool last_success;
-    DockingStation * human_ds;
-    DockingStation * ai_ds;
+    DockingStation * human_ds; // the docking station that we are shooting at
+    DockingStation * ai_ds;    // our own ships
+    AIStrategy strategy;
+    XoshiroState * rng;        // private generator, when NULL the global one behind `unif` is used
+    DensityMap density;        // what we know about the enemy fleet, used by AI_DENSITY and AI_MONTE_CARLO
+    UntriedCells untried;      // cells of the enemy board that we haven't fired at yet
+    MonteCarlo * monte_carlo;  // search used by AI_MONTE_CARLO, when NULL one is set up with MONTE_CARLO_DEFAULTS for each decision
+    TranspositionTable * cache; // decisions of AI_DENSITY and AI_MONTE_CARLO already made, may be NULL and may be shared
+    uint64_t hash;             // Zobrist hash of what we observed on the enemy board
+    const PlacementBook * book; // fleets to place our ships from (battleship_book.h), may be NULL and may be shared
 
 } AI;
 
+// Forget everything about the previous game, call before reusing an AI
+void ai_reset(AI * ai) {
 
-// need a way to place all of the ships
-void ai_place_ships(AI * ai) {
-// Basic algorithm to have the ai choose a ship placement.
+    ai->last_i = 0;
+    ai->last_j = 0;
+    ai->last_direction = 0;
+    ai->last_success = false;
+    ai->density.ready = false;
+    ai->untried.ready = false;
+    ai->hash = 0;
+}
+
+// uniform integer in [a, b] drawn from the AI's generator
+int ai_unif(AI * ai, int a, int b) {
+    return ai->rng ? xoshiro_unif(ai->rng, a, b) : unif(a, b);
+}
+
+// True if the strategy doesn't draw from its generator, so that it always plays the same game against
+// the same fleet
+bool ai_strategy_is_deterministic(AIStrategy strategy) {
+    return strategy == AI_DENSITY;
+}
 
-// Before I implement the placement stage, I want to get a random list of positions that have at least
-// one valid direction
+// Return the strategy whose name is `name`, or -1 if there is no such strategy
+int ai_strategy_from_name(const char * name) {
+
+    for (int i = 0; i < NUM_AI_STRATEGIES; i ++) {
+        if ( strcmp(name, AI_STRATEGY_NAMES[i]) == 0 ) {
+            return i;
+        }
+    }
+
+    return -1;
+}
 
-// that is way fucking overkill, I literally just need to get a random position and check to make sure
-// there is at least one direction in which I can place a ship.
+
+// need a way to place all of the ships
+bool ai_place_ships(AI * ai) {
+// Pick a fleet of ai->book when there is one, otherwise draw the whole fleet uniformly among all of the
+// legal fleets (see battleship_sampler.h). Returns false, with no ship added, if the ships that are
+// missing can't fit around the ones already on the board
 
     Board board = ai->ai_ds->board;
+    uint64_t start = timing_start();
 
-    int irow = 0, jcol = 0, num_valid_directions = 0, direction = 0;
-    char * cptr = NULL;
+    if ( ai->book && bb_is_empty(board->occupied) ) {
+        book_place_fleet(board, &ai->book->entries[ai_unif(ai, 0, ai->book->header.num_fleets - 1)]);
+        timing_stop(PHASE_PLACEMENT, start);
+        return true;
+    }
 
-    // place the ship, but the first ship has free choice for a number on the board.
-    for (int i = 0; i < NUM_SHIPS; i ++) {
+    FleetSampler fs;
+    Fleet fleet;
+    XoshiroState local_rng;
+    XoshiroState * rng = ai->rng;
+
+    if (rng == NULL) { // seed a generator from the global one
+        xoshiro_seed(&local_rng, ((uint64_t) unif(0, 0x7FFFFFFF) << 32) ^ (uint64_t) unif(0, 0x7FFFFFFF));
+        rng = &local_rng;
+    }
 
-        num_valid_directions = 0;
+    const FleetSampler * sampler = full_fleet_sampler();
 
-        // randomly decide a position that has at least one direction to go to.
-        while(num_valid_directions == 0) {
+    if ( !bb_is_empty(board->occupied) ) { // some ships are already there, only place the others
 
-            irow = unif(0, NUM_SHIPS-1);
-            jcol = unif(0, NUM_SHIPS-1);
+        uint8_t ship_set = 0;
 
-            // check to see if the position is valid
-            cptr = get_valid_directions(board, irow, jcol, SHIP_LENGTHS[i], &num_valid_directions);
+        for (int s = 0; s < NUM_SHIPS; s ++) {
+            if ( bb_is_empty(board->ships[s]) ) ship_set |= 1 << s;
+        }
 
+        if (ship_set == 0) {
+            timing_stop(PHASE_PLACEMENT, start);
+            return true;
         }
 
-        // randomly choose one of the directions
-        direction = unif(0, num_valid_directions - 1);
-        place_ship(irow, jcol, cptr[direction], board, SHIP_TYPES[i], SHIP_LENGTHS[i]);
-        printf("[AI]\t placed ship %s at %c%d with orientation %c\n", SHIP_FULL_NAMES[i], LETTERS[irow], NUMBERS[jcol], cptr[direction]);
+        fleet_sampler_init(&fs, board->occupied, ship_set);
+        sampler = &fs;
+    }
+
+    bool placed = fleet_sampler_draw(sampler, rng, &fleet);
+
+    if (placed) place_fleet(board, &fleet);
+
+    timing_stop(PHASE_PLACEMENT, start);
+
+    return placed;
+}
+
+// Run the Monte Carlo search of AI_MONTE_CARLO, the coverage of each cell is stored in `prob`
+int ai_monte_carlo_cell(AI * ai, float prob[BB_CELLS]) {
+
+    XoshiroState local_rng;
+    XoshiroState * rng = ai->rng;
+
+    if (rng == NULL) {
+        xoshiro_seed(&local_rng, ((uint64_t) unif(0, 0x7FFFFFFF) << 32) ^ (uint64_t) unif(0, 0x7FFFFFFF));
+        rng = &local_rng;
+    }
+
+    if (ai->monte_carlo) {
+        return monte_carlo_best_cell(ai->monte_carlo, &ai->density, rng, prob);
+    }
+
+    MonteCarlo mc;
+    monte_carlo_init(&mc, MONTE_CARLO_DEFAULTS);
+    int cell = monte_carlo_best_cell(&mc, &ai->density, rng, prob);
+    monte_carlo_destroy(&mc);
+
+    return cell;
+}
+
+// Target of AI_DENSITY and AI_MONTE_CARLO. The decision is looked up in ai->cache first and stored
+// there once it has been made
+int ai_best_cell(AI * ai) {
+
+    uint64_t key = 0;
+    float prob[BB_CELLS];
+
+    if (ai->cache) {
+
+        key = ai->hash ^ ZOBRIST_STRATEGY[ai->strategy];
+        int cell = transposition_probe(ai->cache, key, NULL);
 
+        // a collision could hand us a cell that we already tried
+        if ( cell != -1 && !bb_test(ai->density.tried, cell) ) return cell;
     }
 
-    printf("[AI]\t placed all ships!\n\n");
+    int cell;
 
+    if (ai->strategy == AI_MONTE_CARLO) {
+        cell = ai_monte_carlo_cell(ai, prob);
+    } else {
+        density_probabilities(&ai->density, prob);
+        cell = density_pick(prob, ai->density.tried);
+    }
+
+    if (ai->cache) transposition_store(ai->cache, key, cell, prob);
+
+    return cell;
 }
 
 // char * AI_DIRECTIONS = NULL; // List of directions that AI has attempted already
@@ -69,39 +197,33 @@ void ai_place_ships(AI * ai) {
 
 uint8_t ai_choose_direction(AI * ai, int * __i, int * __j) {
 // choose a tile and return its value
-    // First branch is "did I get a hit last time?"
     int i_choice = 0, j_choice = 0;
     Board human_board = ai->human_ds->board;
-    // If I got a hit, follow this algorithm
-    if (ai->last_success) {
 
-        puts("WE GOT A HIT!!!! WHAT TO DO NOW???");
-        dsleep(5);
+    if (ai->strategy == AI_DENSITY || ai->strategy == AI_MONTE_CARLO) {
 
-        return 0;
+        if ( !ai->density.ready ) density_reset(&ai->density);
 
-    } else { // If I missed, choose a position randomly
+        int cell = ai_best_cell(ai);
 
+        *__i = cell / BOARD_SIZE;
+        *__j = cell % BOARD_SIZE;
+        return get_location_flag(human_board, *__i, *__j);
+    }
 
-        // printf("Choosing direction with rng seeded:\n");
-        // print_xoshiro256ss_state(&XOSHIRO_RNG);
-
-        i_choice = unif(0, BOARD_SIZE - 1);
-        j_choice = unif(0, BOARD_SIZE - 1);
+    // AI_RANDOM doesn't care whether we got a hit last time (ai->last_success), every position is
+    // chosen uniformly among the untried ones
 
-        // printf("Chose i: %d\tChose j: %d\n", i_choice, j_choice);
+    if ( !ai->untried.ready ) untried_reset(&ai->untried, human_board->attempted);
 
-        while ( is_attempted(human_board[i_choice * BOARD_SIZE + j_choice] )) {
-            i_choice = unif(0, BOARD_SIZE - 1);
-            j_choice = unif(0, BOARD_SIZE - 1);
-            // puts("This location has already been attempted");
-        }
+    int cell = ai->untried.cells[ai_unif(ai, 0, ai->untried.count - 1)];
 
-        *__i = i_choice;
-        *__j = j_choice;
-        return human_board[i_choice * BOARD_SIZE + j_choice];
+    i_choice = cell / BOARD_SIZE;
+    j_choice = cell % BOARD_SIZE;
 
-    }
+    *__i = i_choice;
+    *__j = j_choice;
+    return get_location_flag(human_board, i_choice, j_choice);
 
 }
 
@@ -115,106 +237,174 @@ void cheat() {
 }
 
 
-// need a way to attack the players ships. Pass the player turn as the value for the AI to attack
-// return the string of the choice
-void ai_turn(AI * ai) {
-// start off by randomly attacking the enemy ships and seeing if i get a hit or not.
+// Choose a target, fire at it and remember how it went. Returns the result of the shot and stores
+// the chosen location in (*__i, *__j). Nothing is printed: see ai_turn in battleship_cli.h for the
+// interactive version
+ShotResult ai_take_shot(AI * ai, int * __i, int * __j) {
+
+    int i = 0, j = 0;
+    uint64_t choose = timing_start();
+
+    ai_choose_direction(ai, &i, &j);
+
+    uint64_t resolve = timing_start();
+    ShotResult result = fire(ai->human_ds, i, j);
+    uint64_t learn = timing_start();
+
+    if (ai->density.ready) {
+        density_observe(&ai->density, i*BOARD_SIZE + j, result);
+    }
+
+    ai->hash = zobrist_observe(ai->hash, i*BOARD_SIZE + j, result);
+
+    if (ai->untried.ready) {
+        untried_remove(&ai->untried, i*BOARD_SIZE + j);
+    }
+
+    ai->last_success = result.outcome == SHOT_HIT || result.outcome == SHOT_SUNK;
+    ai->last_i = i;
+    ai->last_j = j;
+
+    // choosing the target and learning from the outcome are the decision, firing is the resolution
+    timing_record(PHASE_RESOLUTION, learn - resolve);
+    timing_record(PHASE_DECISION, timing_start() - learn + resolve - choose);
+
+    *__i = i;
+    *__j = j;
+
+    return result;
+}
 
-    DockingStation * ds = ai->human_ds;
-    // printf("\n\n AI'S TURN!!! \n\n");
+// Choose the `n` cells of a salvo (at most the number of untried cells), before knowing how any of them
+// went: AI_DENSITY and AI_MONTE_CARLO take the `n` untried cells most likely to hold a ship, AI_RANDOM
+// `n` distinct untried cells. Returns the number of cells chosen
+int ai_choose_salvo(AI * ai, int n, int cells[MAX_SALVO]) {
 
-    int i = 0, j = 0, value = 0;
-    bool turn_over = false;
+    Board human_board = ai->human_ds->board;
+    int count = 0;
 
-    // int * ai_selection = (int *) malloc(sizeof(int) * 2);
+    if (n > MAX_SALVO) n = MAX_SALVO;
 
-    while (!turn_over) {
+    if (ai->strategy == AI_DENSITY || ai->strategy == AI_MONTE_CARLO) {
 
-        // Guess the position completely randomly..., let's go ahead and choose this way smarter
+        if ( !ai->density.ready ) density_reset(&ai->density);
 
-        value = ai_choose_direction(ai, &i, &j);
+        float prob[BB_CELLS];
+        Bitboard taken = ai->density.tried;
 
-        if ( is_occupied(value) ) { // We got a hit!!!
+        if (ai->strategy == AI_MONTE_CARLO) ai_monte_carlo_cell(ai, prob);
+        else density_probabilities(&ai->density, prob);
 
-            printf("%c%d\n", LETTERS[i], j + 1);
-            puts("");
-            dsleep(0.15);
+        for (; count < n; count ++) {
+            int cell = density_pick(prob, taken);
+            if (cell == -1) break;
+            cells[count] = cell;
+            bb_set(&taken, cell);
+        }
 
+        return count;
+    }
 
-            printf("Hit. ");
-            ds->board[i*10 + j] += (HIT + ATTEMPTED);
-            ai->last_success = true;
+    if ( !ai->untried.ready ) untried_reset(&ai->untried, human_board->attempted);
 
-            if ( is_carrier(value) ) {
-                ds->carrier_lives_left --;
+    // the chosen cells leave the set right away so that they can't be drawn twice
+    for (; count < n && ai->untried.count > 0; count ++) {
+        cells[count] = ai->untried.cells[ai_unif(ai, 0, ai->untried.count - 1)];
+        untried_remove(&ai->untried, cells[count]);
+    }
 
-                if ( ds->carrier_lives_left == 0 ) {
-                    printf("AI sunk my carrier!!!\n");
-                } else {
-                    printf("Carrier\n");
-                }
-            } else if ( is_battleship(value) ) {
-                ds->battleship_lives_left --;
+    return count;
+}
 
-                if ( ds->battleship_lives_left == 0 ) {
-                    printf("AI sunk my battleship!!!\n");
-                } else {
-                    printf("Battleship\n");
-                }
-            } else if ( is_cruiser(value) ) {
-                ds->cruiser_lives_left --;
+// Fire a salvo of `n` shots and learn from all of them. The chosen cells are stored in `cells`
+SalvoResult ai_take_salvo(AI * ai, int n, int cells[MAX_SALVO]) {
 
-                if ( ds->cruiser_lives_left == 0 ) {
-                    printf("AI sunk my cruiser!!!\n");
-                } else {
-                    printf("Cruiser\n");
-                }
-            } else if ( is_submarine(value) ) {
-                ds->submarine_lives_left --;
+    uint64_t choose = timing_start();
+    n = ai_choose_salvo(ai, n, cells);
 
-                if ( ds->submarine_lives_left == 0 ) {
-                    printf("AI sunk my submarine!!!\n");
-                } else {
-                    printf("Submarine\n");
-                }
-            } else if ( is_destroyer(value) ) {
-                ds->destroyer_lives_left --;
+    uint64_t resolve = timing_start();
+    SalvoResult salvo = fire_salvo(ai->human_ds, cells, n);
+    uint64_t learn = timing_start();
 
-                if ( ds->destroyer_lives_left == 0 ) {
-                    printf("AI sunk my destroyer!!!\n");
-                } else {
-                    printf("Destroyer\n");
-                }
-            }
+    ai->last_success = false;
 
-        } else { // Then we missed!
+    for (int k = 0; k < salvo.num_shots; k ++) {
 
-            printf("%c%d\n", LETTERS[i], j + 1);
+        if (ai->density.ready) {
+            density_observe(&ai->density, cells[k], salvo.results[k]);
+        }
 
-            printf("Miss!\n");
-            ds->board[i*10 + j] += (MISS + ATTEMPTED);
-            ai->last_success = false;
+        ai->hash = zobrist_observe(ai->hash, cells[k], salvo.results[k]);
 
+        if (ai->untried.ready) {
+            untried_remove(&ai->untried, cells[k]);
         }
-        turn_over = true;
-        ai->last_i = i;
-        ai->last_j = j;
+
+        ai->last_success |= salvo.results[k].outcome == SHOT_HIT || salvo.results[k].outcome == SHOT_SUNK;
     }
 
-    // ai_selection[0] = i;
-    // ai_selection[1] = j;
+    if (salvo.num_shots > 0) {
+        ai->last_i = cells[salvo.num_shots - 1] / BOARD_SIZE;
+        ai->last_j = cells[salvo.num_shots - 1] % BOARD_SIZE;
+    }
 
-    // return ai_selection;
+    timing_record(PHASE_RESOLUTION, learn - resolve);
+    timing_record(PHASE_DECISION, timing_start() - learn + resolve - choose);
 
+    return salvo;
 }
 
+// Play a whole game between two AIs without any I/O. `first` shoots first, each AI's human_ds must be
+// the other's ai_ds and both fleets must already be placed. Returns 0 if `first` won and 1 otherwise,
+// the number of shots fired by the winner is stored in *winner_shots. When `record` isn't NULL, the
+// shots are appended to it with `first` as side 0
+int ai_vs_ai(AI * first, AI * second, int * winner_shots, GameRecord * record) {
+
+    AI * players[2] = {first, second};
+    int shots[2] = {0, 0};
+    int turn = 0, i = 0, j = 0;
+
+    while (true) {
 
+        ShotResult result = ai_take_shot(players[turn], &i, &j);
+        shots[turn] ++;
 
+        record_shot(record, turn, i, j, result);
 
+        if ( result.game_over ) {
+            *winner_shots = shots[turn];
+            return turn;
+        }
+
+        turn = 1 - turn;
+    }
+}
+
+// ai_vs_ai with salvo rules: each turn an AI fires one shot per ship that it still has afloat. The
+// number of shots fired by the winner is stored in *winner_shots
+int ai_vs_ai_salvo(AI * first, AI * second, int * winner_shots, GameRecord * record) {
 
+    AI * players[2] = {first, second};
+    int shots[2] = {0, 0};
+    int cells[MAX_SALVO];
+    int turn = 0;
 
+    while (true) {
 
+        SalvoResult salvo = ai_take_salvo(players[turn], salvo_size(players[turn]->ai_ds), cells);
+        shots[turn] += salvo.num_shots;
 
+        for (int k = 0; k < salvo.num_shots; k ++) {
+            record_shot(record, turn, cells[k] / BOARD_SIZE, cells[k] % BOARD_SIZE, salvo.results[k]);
+        }
+
+        if ( salvo.game_over || salvo.num_shots == 0 ) {
+            *winner_shots = shots[turn];
+            return turn;
+        }
 
+        turn = 1 - turn;
+    }
+}
 
 #endif
\ No newline at end of file
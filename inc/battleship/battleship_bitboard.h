@@ -0,0 +1,126 @@
+#ifndef BATTLESHIP_BITBOARD
+#define BATTLESHIP_BITBOARD
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A Bitboard is a 128 bit mask with one bit per cell of a 10x10 board. Cell (i, j)
+// lives at bit i * 10 + j, so bits 0..63 are stored in w[0] and bits 64..99 in w[1].
+// The top 28 bits of w[1] are never set.
+
+typedef struct Bitboard {
+
+    uint64_t w[2];
+
+} Bitboard;
+
+#define BB_CELLS 100
+#define BB_WIDTH 10
+
+static inline Bitboard bb_empty(void) {
+    Bitboard b = {{0, 0}};
+    return b;
+}
+
+static inline Bitboard bb_full(void) {
+    Bitboard b = {{~0ULL, (1ULL << (BB_CELLS - 64)) - 1}};
+    return b;
+}
+
+static inline Bitboard bb_cell(int cell) {
+    Bitboard b = {{0, 0}};
+    b.w[cell >> 6] = 1ULL << (cell & 63);
+    return b;
+}
+
+static inline Bitboard bb_and(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.w[0] & b.w[0], a.w[1] & b.w[1]}};
+    return r;
+}
+
+static inline Bitboard bb_or(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.w[0] | b.w[0], a.w[1] | b.w[1]}};
+    return r;
+}
+
+static inline Bitboard bb_xor(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.w[0] ^ b.w[0], a.w[1] ^ b.w[1]}};
+    return r;
+}
+
+// a & ~b
+static inline Bitboard bb_andnot(Bitboard a, Bitboard b) {
+    Bitboard r = {{a.w[0] & ~b.w[0], a.w[1] & ~b.w[1]}};
+    return r;
+}
+
+static inline bool bb_is_empty(Bitboard a) {
+    return (a.w[0] | a.w[1]) == 0;
+}
+
+static inline bool bb_intersects(Bitboard a, Bitboard b) {
+    return ((a.w[0] & b.w[0]) | (a.w[1] & b.w[1])) != 0;
+}
+
+// is every bit of a also set in b?
+static inline bool bb_subset(Bitboard a, Bitboard b) {
+    return ((a.w[0] & ~b.w[0]) | (a.w[1] & ~b.w[1])) == 0;
+}
+
+static inline bool bb_equal(Bitboard a, Bitboard b) {
+    return a.w[0] == b.w[0] && a.w[1] == b.w[1];
+}
+
+static inline int bb_popcount(Bitboard a) {
+    return __builtin_popcountll(a.w[0]) + __builtin_popcountll(a.w[1]);
+}
+
+static inline bool bb_test(Bitboard a, int cell) {
+    return (a.w[cell >> 6] >> (cell & 63)) & 1;
+}
+
+static inline void bb_set(Bitboard * a, int cell) {
+    a->w[cell >> 6] |= 1ULL << (cell & 63);
+}
+
+static inline void bb_clear(Bitboard * a, int cell) {
+    a->w[cell >> 6] &= ~(1ULL << (cell & 63));
+}
+
+// index of the lowest set bit, the mask must not be empty
+static inline int bb_first(Bitboard a) {
+    return a.w[0] ? __builtin_ctzll(a.w[0]) : 64 + __builtin_ctzll(a.w[1]);
+}
+
+// remove and return the lowest set bit, used to iterate over the cells of a mask:
+//      while (!bb_is_empty(m)) { int cell = bb_pop_first(&m); ... }
+static inline int bb_pop_first(Bitboard * a) {
+    int cell = bb_first(*a);
+    bb_clear(a, cell);
+    return cell;
+}
+
+// Mask of a straight line of `length` cells starting at (i, j) and advancing by (i_inc, j_inc).
+// Returns the empty mask if any part of the line falls outside of the board.
+static inline Bitboard bb_line(int i, int j, int i_inc, int j_inc, int length) {
+
+    Bitboard b = bb_empty();
+
+    int i_end = i + (length - 1) * i_inc;
+    int j_end = j + (length - 1) * j_inc;
+
+    if (i < 0 || j < 0 || i >= BB_WIDTH || j >= BB_WIDTH ||
+        i_end < 0 || j_end < 0 || i_end >= BB_WIDTH || j_end >= BB_WIDTH) {
+        return b;
+    }
+
+    for (int n = 0; n < length; n ++) {
+        bb_set(&b, i * BB_WIDTH + j);
+        i += i_inc;
+        j += j_inc;
+    }
+
+    return b;
+}
+
+#endif
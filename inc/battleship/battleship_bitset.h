@@ -0,0 +1,103 @@
+#ifndef BATTLESHIP_BITSET
+#define BATTLESHIP_BITSET
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Heap allocated, word packed set of bits. This is the Bitboard of battleship_bitboard.h for boards
+// whose size is only known at runtime: bit `cell` lives in w[cell / 64].
+
+typedef struct BitSet {
+
+    int num_bits;
+    int num_words;
+    uint64_t * w;
+
+} BitSet;
+
+BitSet bitset_new(int num_bits) {
+
+    BitSet b;
+
+    b.num_bits = num_bits;
+    b.num_words = (num_bits + 63) / 64;
+    b.w = (uint64_t *) calloc(b.num_words, sizeof(uint64_t));
+
+    return b;
+}
+
+void bitset_free(BitSet * b) {
+    free(b->w);
+    b->w = NULL;
+}
+
+void bitset_clear_all(BitSet * b) {
+    memset(b->w, 0, sizeof(uint64_t) * b->num_words);
+}
+
+static inline bool bitset_test(const BitSet * b, int bit) {
+    return (b->w[bit >> 6] >> (bit & 63)) & 1;
+}
+
+static inline void bitset_set(BitSet * b, int bit) {
+    b->w[bit >> 6] |= 1ULL << (bit & 63);
+}
+
+static inline void bitset_clear(BitSet * b, int bit) {
+    b->w[bit >> 6] &= ~(1ULL << (bit & 63));
+}
+
+// Mask of the bits of [start, start + length) that fall in the word containing `start`, the number of
+// bits that it covers is stored in *taken
+static inline uint64_t bitset_word_mask(int start, int length, int * taken) {
+
+    int offset = start & 63;
+    int n = 64 - offset < length ? 64 - offset : length;
+
+    *taken = n;
+    return (n == 64 ? ~0ULL : ((1ULL << n) - 1)) << offset;
+}
+
+// Is any bit of [start, start + length) set? A run of a few bits is one or two word tests
+bool bitset_any_in_range(const BitSet * b, int start, int length) {
+
+    while (length > 0) {
+
+        int taken = 0;
+        uint64_t mask = bitset_word_mask(start, length, &taken);
+
+        if (b->w[start >> 6] & mask) return true;
+
+        start += taken;
+        length -= taken;
+    }
+
+    return false;
+}
+
+void bitset_set_range(BitSet * b, int start, int length) {
+
+    while (length > 0) {
+
+        int taken = 0;
+        b->w[start >> 6] |= bitset_word_mask(start, length, &taken);
+
+        start += taken;
+        length -= taken;
+    }
+}
+
+int bitset_popcount(const BitSet * b) {
+
+    int count = 0;
+
+    for (int i = 0; i < b->num_words; i ++) {
+        count += __builtin_popcountll(b->w[i]);
+    }
+
+    return count;
+}
+
+#endif
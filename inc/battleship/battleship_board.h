@@ -5,8 +5,9 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
-
-typedef uint8_t * Board;
+#include <string.h>
+#include "battleship_bitboard.h"
+#include "battleship_masks.h"
 
 const uint8_t CARRIER =     0b00000001;
 const uint8_t BATTLESHIP =  0b00000010;
@@ -34,41 +35,84 @@ const int SHIP_LENGTHS[5] = {CARRIER_LENGTH, BATTLESHIP_LENGTH, CRUISER_LENGTH,
 const char SHIP_LETTERS[5] = {'C', 'B', 'R', 'S', 'D'};
 const char SHIP_FULL_NAMES[5][15] = {"CARRIER", "BATTLESHIP", "CRUISER", "SUBMARINE", "DESTROYER"};
 
+// The board is stored as a set of bitboards instead of one flag byte per cell. Each ship type has
+// its own occupancy mask (indexed like SHIP_TYPES, ie by the position of the ship's flag bit) so that
+// placement validation, hit tests and sunk checks are a handful of AND / popcount operations.
+typedef struct BoardMasks {
+
+    Bitboard ships[5];  // occupancy of each ship type
+    Bitboard occupied;  // union of all of the ship masks
+    Bitboard attempted;
+    Bitboard hit;
+    Bitboard miss;
+    int8_t ship_at[BB_CELLS];   // index of the ship covering each cell (ship_index of its flag), -1 for water
+
+} BoardMasks;
+
+typedef BoardMasks * Board;
+
+// Ship registry: everything about a ship lives at the same index in every array, the index of its flag
+// bit in SHIP_TYPES (see ship_index). Resolving a hit is then a lookup in board->ship_at, a decrement of
+// lives[ship] and setting a bit of `sunk`, without going through the ships one by one.
+#define ALL_SHIPS_SUNK ((1 << 5) - 1)
+
 typedef struct DockingStation { // Docking station contains information about the board, how many lives are left
 
     Board board;
-    uint8_t carrier_lives_left;
-    uint8_t battleship_lives_left;
-    uint8_t cruiser_lives_left;
-    uint8_t submarine_lives_left;
-    uint8_t destroyer_lives_left;
+    uint8_t lives[5];   // cells of each ship that haven't been hit yet, indexed like SHIP_TYPES
+    uint8_t sunk;       // bit s is set once SHIP_TYPES[s] has been sunk
 
 } DockingStation;
 
+void clear_board(Board board) {
+
+    for (int k = 0; k < NUM_SHIPS; k ++) {
+        board->ships[k] = bb_empty();
+    }
+
+    board->occupied = bb_empty();
+    board->attempted = bb_empty();
+    board->hit = bb_empty();
+    board->miss = bb_empty();
+
+    memset(board->ship_at, -1, sizeof(board->ship_at));
+}
+
+void reset_ship_registry(DockingStation * ds) {
+
+    for (int k = 0; k < NUM_SHIPS; k ++) {
+        ds->lives[k] = SHIP_LENGTHS[k];
+    }
+
+    ds->sunk = 0;
+}
+
 DockingStation make_new_game(int size) {
+// The masks are sized for a BOARD_SIZE x BOARD_SIZE board, `size` is kept for compatibility
+
+    (void) size;
 
     DockingStation d;
 
-    Board board = (Board) malloc( sizeof(uint8_t) * (size * size) );
+    Board board = (Board) malloc( sizeof(BoardMasks) );
 
     // initialize board
-    for (int i = 0; i < size; i ++) {
-        for (int j = 0; j < size; j ++) {
-            board[i * size + j] = 0;
-        }
-    }
+    clear_board(board);
 
     d.board = board;
-    d.carrier_lives_left = CARRIER_LENGTH;
-    d.battleship_lives_left = BATTLESHIP_LENGTH;
-    d.cruiser_lives_left = CRUISER_LENGTH;
-    d.submarine_lives_left = SUBMARINE_LENGTH;
-    d.destroyer_lives_left = DESTROYER_LENGTH;
+    reset_ship_registry(&d);
 
     return d;
 
 }
 
+// Empty the board and restore every ship's lives so that the same DockingStation can be reused for another game
+void reset_docking_station(DockingStation * ds) {
+
+    clear_board(ds->board);
+    reset_ship_registry(ds);
+}
+
 // Provide functions to create a new board, keep track of the board, print the board, etc
 
 // Implement the board
@@ -122,7 +166,68 @@ bool is_hit(uint8_t flag) {
 }
 
 bool is_occupied(uint8_t flag) {
-    return (is_carrier(flag) || is_battleship(flag) || is_cruiser(flag) || is_submarine(flag) || is_destroyer(flag));
+    return (flag & (CARRIER | BATTLESHIP | CRUISER | SUBMARINE | DESTROYER)) != 0;
+}
+
+// Index of a ship type in SHIP_TYPES / SHIP_LENGTHS / BoardMasks.ships
+int ship_index(uint8_t ship_type) {
+    return __builtin_ctz(ship_type);
+}
+
+// Gather the ship bits of a cell into the low 5 bits of a flag, without branching
+uint8_t get_ship_bits(Board board, int cell) {
+
+    int w = cell >> 6;
+    int s = cell & 63;
+
+    return  ((board->ships[0].w[w] >> s) & 1)       |
+            ((board->ships[1].w[w] >> s) & 1) << 1  |
+            ((board->ships[2].w[w] >> s) & 1) << 2  |
+            ((board->ships[3].w[w] >> s) & 1) << 3  |
+            ((board->ships[4].w[w] >> s) & 1) << 4;
+}
+
+// Rebuild the flag byte of the location (i, j) so that it can be inspected with is_carrier, is_hit, ...
+uint8_t get_location_flag(Board board, int i, int j) {
+
+    int cell = i*BOARD_SIZE + j;
+    int w = cell >> 6;
+    int s = cell & 63;
+
+    return  get_ship_bits(board, cell)                          |
+            ((board->attempted.w[w] >> s) & 1) << 5             |
+            ((board->miss.w[w] >> s) & 1) << 6                  |
+            ((board->hit.w[w] >> s) & 1) << 7;
+}
+
+// Record a shot at (i, j), returns the flag of the location BEFORE the shot was recorded
+uint8_t mark_shot(Board board, int i, int j) {
+
+    uint8_t flag = get_location_flag(board, i, j);
+    Bitboard cell = bb_cell(i*BOARD_SIZE + j);
+
+    board->attempted = bb_or(board->attempted, cell);
+
+    if ( is_occupied(flag) ) {
+        board->hit = bb_or(board->hit, cell);
+    } else {
+        board->miss = bb_or(board->miss, cell);
+    }
+
+    return flag;
+}
+
+// number of cells of the ship that haven't been hit yet
+int ship_lives_left(Board board, uint8_t ship_type) {
+    return bb_popcount(bb_andnot(board->ships[ship_index(ship_type)], board->hit));
+}
+
+bool is_sunk(Board board, uint8_t ship_type) {
+    return bb_subset(board->ships[ship_index(ship_type)], board->hit);
+}
+
+bool is_fleet_sunk(Board board) {
+    return bb_subset(board->occupied, board->hit);
 }
 
 /**========================================================================
@@ -163,22 +268,41 @@ void set_direction(int * i_ptr, int * j_ptr, char direction) {
 
 }
 
-void place_ship(int i, int j, char direction, Board board, uint8_t ship_type, int ship_length) {
+// Index of a direction in DIRECTIONS ('N', 'E', 'S', 'W'), -1 if the character isn't a direction
+int direction_index(char direction) {
+
+    switch(direction) {
+        case 'N': return 0;
+        case 'E': return 1;
+        case 'S': return 2;
+        case 'W': return 3;
+    }
 
-    int i_inc = 0;
-    int j_inc = 0;
+    return -1;
+}
+
+// Mask of the cells covered by a ship, empty if the ship doesn't fit on the board
+Bitboard placement_mask(int i, int j, char direction, int ship_length) {
 
-    set_direction(&i_inc, &j_inc, direction);
+    int d = direction_index(direction);
+
+    if ( d == -1 || i < 0 || i >= BOARD_SIZE || j < 0 || j >= BOARD_SIZE || ship_length < 0 || ship_length > MAX_SHIP_LENGTH ) {
+        return bb_empty();
+    }
 
-    // printf("Placing ship with length %d in direction %c\n", ship_length, direction);
-    // printf("i_inc = %d, j_inc = %d\n", i_inc, j_inc);
+    return PLACEMENT_MASKS[ship_length][i*BOARD_SIZE + j][d];
+}
+
+void place_ship(int i, int j, char direction, Board board, uint8_t ship_type, int ship_length) {
 
-    for(int n = 0; n < ship_length; n ++) {
+    Bitboard mask = placement_mask(i, j, direction, ship_length);
+    int k = ship_index(ship_type);
 
-        board[i*BOARD_SIZE + j] += ship_type;
-        i += i_inc;
-        j += j_inc;
+    board->ships[k] = bb_or(board->ships[k], mask);
+    board->occupied = bb_or(board->occupied, mask);
 
+    while ( !bb_is_empty(mask) ) {
+        board->ship_at[bb_pop_first(&mask)] = k;
     }
 }
 
@@ -206,29 +330,11 @@ bool validate_placement(int i, int j, char direction, Board board, int ship_leng
 
     // printf("VALIDATING_PLACEMENT of i = %d, j = %d, dir = %c, len = %d\n", i, j, direction, ship_length);
 
-    int i_inc = 0;
-    int j_inc = 0;
-
-    set_direction(&i_inc, &j_inc, direction);
-
-    // if any of the indexes would go out of bounds
-    if (i + (ship_length - 1) * i_inc > (BOARD_SIZE - 1) || i + (ship_length - 1) * i_inc < 0 || j + (ship_length - 1) * j_inc > (BOARD_SIZE - 1) || j + (ship_length - 1) * j_inc < 0) {
-        return false;
-    }
-
-    // if any of the spots in that direction are occupied
-    for(int n = 0; n < ship_length; n ++) {
-
-        // printf("Checking if %c%d is occupied\n", LETTERS[i], NUMBERS[j]);
-        if( is_occupied(board[i*BOARD_SIZE + j]) ) {
-            return false;
-        }
-        i += i_inc;
-        j += j_inc;
-    }
+    // the mask is empty if any of the indexes would go out of bounds
+    Bitboard mask = placement_mask(i, j, direction, ship_length);
 
-    // If none of the previous conditions are met, return true;
-    return true;
+    // valid if the ship fits on the board and none of the spots in that direction are occupied
+    return !bb_is_empty(mask) && !bb_intersects(mask, board->occupied);
 }
 
 // bool validate_carrier(int i, int j, char direction, uint8_t * board) {
@@ -252,6 +358,36 @@ bool validate_placement(int i, int j, char direction, Board board, int ship_leng
 // }
 
 
+char get_location_char(Board board, int i, int j) {
+
+    int cell = i*BOARD_SIZE + j;
+    uint8_t ships = get_ship_bits(board, cell);
+
+    if ( bb_test(board->hit, cell) ) {
+        return 'x';
+    } else if ( ships ) {
+        return SHIP_LETTERS[__builtin_ctz(ships)];
+    } else if ( bb_test(board->miss, cell) ) {
+        return '-';
+    } else {
+        return ' ';
+    }
+}
+
+char get_location_char_enemy(Board board, int i, int j) {
+// only show hits and misses for the enemy
+
+    int cell = i*BOARD_SIZE + j;
+
+    if ( bb_test(board->hit, cell) ) {
+        return SHIP_LETTERS[__builtin_ctz(get_ship_bits(board, cell))];
+    } else if ( bb_test(board->miss, cell) ) {
+        return '-';
+    } else {
+        return ' ';
+    }
+}
+
 // print board
 void print_full_board(Board board) {
 
@@ -271,25 +407,8 @@ void print_full_board(Board board) {
 
         for(int j = 0; j < BOARD_SIZE; j ++) {
 
-            if ( is_hit(board[i*BOARD_SIZE + j] ) ) {
-                c = 'X';
-            } else if ( is_carrier(board[i*BOARD_SIZE + j]) ) {
-                c = 'C';
-            } else if ( is_battleship(board[i*BOARD_SIZE + j]) ) {
-                c = 'B';
-            } else if ( is_cruiser(board[i*BOARD_SIZE + j]) ) {
-                c = 'R';
-            } else if ( is_submarine(board[i*BOARD_SIZE + j]) ) {
-                c = 'S';
-            } else if ( is_destroyer(board[i*BOARD_SIZE + j]) ) {
-                c = 'D';
-            } else if ( is_miss( board[i*BOARD_SIZE + j] ) ) {
-                c = '-';
-            } else {
-                c = ' ';
-            }
-
-            printf("%c ", c);
+            c = get_location_char(board, i, j);
+            printf("%c ", c == 'x' ? 'X' : c);
         }
 
         printf("\n");
@@ -298,57 +417,6 @@ void print_full_board(Board board) {
     printf("\n");
 }
 
-char get_location_char(Board board, int i, int j) {
-
-    char c = '-';
-
-    if ( is_hit(board[i*BOARD_SIZE + j] ) ) {
-        c = 'x';
-    } else if ( is_carrier(board[i*BOARD_SIZE + j]) ) {
-        c = 'C';
-    } else if ( is_battleship(board[i*BOARD_SIZE + j]) ) {
-        c = 'B';
-    } else if ( is_cruiser(board[i*BOARD_SIZE + j]) ) {
-        c = 'R';
-    } else if ( is_submarine(board[i*BOARD_SIZE + j]) ) {
-        c = 'S';
-    } else if ( is_destroyer(board[i*BOARD_SIZE + j]) ) {
-        c = 'D';
-    } else if ( is_miss( board[i*BOARD_SIZE + j] ) ) {
-        c = '-';
-    } else {
-        c = ' ';
-    }
-
-    return c;
-
-}
-
-char get_location_char_enemy(Board board, int i, int j) {
-// only show hits and misses for the enemy
-    char c = '-';
-
-    if ( is_hit(board[i*BOARD_SIZE + j] ) ) {
-        if ( is_carrier(board[i*BOARD_SIZE + j]) ) {
-            c = 'C';
-        } else if ( is_battleship(board[i*BOARD_SIZE + j]) ) {
-            c = 'B';
-        } else if ( is_cruiser(board[i*BOARD_SIZE + j]) ) {
-            c = 'R';
-        } else if ( is_submarine(board[i*BOARD_SIZE + j]) ) {
-            c = 'S';
-        } else if ( is_destroyer(board[i*BOARD_SIZE + j]) ) {
-            c = 'D';
-        }
-    } else if ( is_miss( board[i*BOARD_SIZE + j] ) ) {
-        c = '-';
-    } else {
-        c = ' ';
-    }
-
-    return c;
-}
-
 void print_docking_station(DockingStation * __left, DockingStation * __right) {
     // print your board to the left and to the right the enemy board
     char c = '-';
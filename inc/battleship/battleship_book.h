@@ -0,0 +1,142 @@
+#ifndef BATTLESHIP_BOOK
+#define BATTLESHIP_BOOK
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "battleship_board.h"
+#include "battleship_placements.h"
+#include "battleship_sampler.h"
+
+// Placement books.
+//
+// A book is a list of fleets chosen offline (src/TP2/ex9/optimize_placement.c) because some targeting
+// strategy needs many shots to sink them. An AI holding a book places its ships by picking one of its
+// fleets at random: the search is paid once, offline, and placing a fleet from the book costs five
+// place_ship calls.
+//
+// The file is a BookHeader followed by `num_fleets` BookEntries, in the byte order of the machine. A ship
+// is stored like in a GameRecord: its first cell times two, plus one if it extends towards the South.
+
+#define BOOK_MAGIC 0x31425342       // "BSB1"
+
+typedef struct BookHeader {
+
+    uint32_t magic;
+    uint32_t num_fleets;
+    uint8_t strategy;               // AIStrategy the fleets were chosen against
+    uint8_t padding[3];
+    float book_shots;               // mean shots needed by `strategy` against the book, on games not used to choose it
+                                    // unless `strategy` is deterministic
+    float random_shots;             // and against uniformly drawn fleets
+
+} BookHeader;
+
+typedef struct BookEntry {
+
+    uint8_t fleet[5];
+    uint8_t padding[3];
+    float mean_shots;               // estimated while searching
+
+} BookEntry;
+
+typedef struct PlacementBook {
+
+    BookHeader header;
+    BookEntry * entries;
+
+} PlacementBook;
+
+void book_encode_fleet(const Fleet * fleet, uint8_t encoded[5]) {
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+        Placement * pl = &PLACEMENT_TABLE.placements[fleet->placements[s]];
+        encoded[s] = 2 * pl->cell + (pl->direction == 'S');
+    }
+}
+
+// Place the fleet of `entry` on an empty board
+void book_place_fleet(Board board, const BookEntry * entry) {
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+        int cell = entry->fleet[s] >> 1;
+        place_ship(cell / BOARD_SIZE, cell % BOARD_SIZE, entry->fleet[s] & 1 ? 'S' : 'E', board, SHIP_TYPES[s], SHIP_LENGTHS[s]);
+    }
+}
+
+// Check that every fleet of the book is a legal fleet
+bool book_validate(const PlacementBook * book) {
+
+    BoardMasks board;
+    clear_board(&board);
+
+    for (uint32_t f = 0; f < book->header.num_fleets; f ++) {
+
+        for (int s = 0; s < NUM_SHIPS; s ++) {
+
+            int cell = book->entries[f].fleet[s] >> 1;
+            char direction = book->entries[f].fleet[s] & 1 ? 'S' : 'E';
+
+            if ( cell >= BB_CELLS || !validate_placement(cell / BOARD_SIZE, cell % BOARD_SIZE, direction, &board, SHIP_LENGTHS[s]) ) {
+                return false;
+            }
+
+            place_ship(cell / BOARD_SIZE, cell % BOARD_SIZE, direction, &board, SHIP_TYPES[s], SHIP_LENGTHS[s]);
+        }
+
+        clear_board(&board);
+    }
+
+    return true;
+}
+
+void book_free(PlacementBook * book) {
+
+    if (book == NULL) return;
+
+    free(book->entries);
+    free(book);
+}
+
+// Read the book at `path`. Returns NULL if it can't be read or isn't a valid book
+PlacementBook * book_load(const char * path) {
+
+    FILE * file = fopen(path, "rb");
+
+    if (file == NULL) return NULL;
+
+    PlacementBook * book = (PlacementBook *) malloc(sizeof(PlacementBook));
+    book->entries = NULL;
+
+    bool ok = fread(&book->header, sizeof(BookHeader), 1, file) == 1 && book->header.magic == BOOK_MAGIC &&
+              book->header.num_fleets > 0 && book->header.num_fleets <= (1 << 24);
+
+    if (ok) {
+        book->entries = (BookEntry *) malloc(sizeof(BookEntry) * book->header.num_fleets);
+        ok = fread(book->entries, sizeof(BookEntry), book->header.num_fleets, file) == book->header.num_fleets;
+    }
+
+    fclose(file);
+
+    if ( !ok || !book_validate(book) ) {
+        book_free(book);
+        return NULL;
+    }
+
+    return book;
+}
+
+bool book_write(const char * path, const BookHeader * header, const BookEntry * entries) {
+
+    FILE * file = fopen(path, "wb");
+
+    if (file == NULL) return false;
+
+    bool ok = fwrite(header, sizeof(BookHeader), 1, file) == 1 &&
+              fwrite(entries, sizeof(BookEntry), header->num_fleets, file) == header->num_fleets;
+
+    return fclose(file) == 0 && ok;
+}
+
+#endif
@@ -6,19 +6,32 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "battleship_board.h"
+#include "battleship_engine.h"
+#include "battleship_ai.h"
+#include "battleship_timing.h"
 // #include <stdio_ext.h>
 
+const char SHIP_NAMES[5][15] = {"Carrier", "Battleship", "Cruiser", "Submarine", "Destroyer"};
+const char SHIP_NAMES_LOWER[5][15] = {"carrier", "battleship", "cruiser", "submarine", "destroyer"};
+
 
 
 // sleep for __s seconds
 void dsleep(double __s) {
 
+    uint64_t start = timing_start();
     usleep(1E6 * __s);
+    timing_stop(PHASE_SLEEP, start);
 
 }
 
+// erase the terminal with ANSI escape codes rather than forking `clear`
 int clear_screen(void) {
-    return system("clear");
+
+    const char seq[] = "\x1b[2J\x1b[H";
+
+    fflush(stdout);
+    return write(STDOUT_FILENO, seq, sizeof(seq) - 1) < 0 ? -1 : 0;
 }
 
 int index_letters(char c) {
@@ -110,79 +123,136 @@ uint32_t input_col_index() {
     return d - 1;
 }
 
-void player_turn(DockingStation * ds) {
-// Prompt the user for a location in the form of 'A8' and process that information
+// Print the outcome of a shot, `sunk_message` is the start of the sentence printed when a ship goes down
+// ("You've sunk my" for the player, "AI sunk my" for the AI)
+void report_shot(ShotResult result, const char * sunk_message) {
+
+    if ( result.outcome == SHOT_MISS ) {
+        printf("Miss!\n");
+        return;
+    }
+
+    printf("Hit. ");
+
+    if ( result.outcome == SHOT_SUNK ) {
+        printf("%s %s!!!\n", sunk_message, SHIP_NAMES_LOWER[result.ship]);
+    } else {
+        printf("%s\n", SHIP_NAMES[result.ship]);
+    }
+}
+
+ShotResult player_turn(DockingStation * ds, int * __i, int * __j) {
+// Prompt the user for a location in the form of 'A8' and process that information. The location that
+// was shot is stored in (*__i, *__j)
 
     uint32_t i = 0;
     uint32_t j = 0;
-    uint8_t value = 0;
+    ShotResult result;
     bool turn_over = false;
 
     while(!turn_over) {
         // get guess
+        uint64_t start = timing_start();
         i = input_row_index();
         j = input_col_index();
-        value = ds->board[i*10 + j];
+        timing_stop(PHASE_INPUT, start);
 
-        if ( is_attempted(value) ) {
+        start = timing_start();
+        result = fire(ds, i, j);
+        timing_stop(PHASE_RESOLUTION, start);
+
+        if ( result.outcome == SHOT_INVALID ) {
             printf("You already tried this location, try again\n");
             continue;
-        } else if ( is_occupied(value) ) { // We got a hit!!!
-
-            printf("Hit. ");
-            ds->board[i*10 + j] += (HIT + ATTEMPTED);
-
-            if ( is_carrier(value) ) {
-                ds->carrier_lives_left --;
-
-                if ( ds->carrier_lives_left == 0 ) {
-                    printf("You've sunk my carrier!!!\n");
-                } else {
-                    printf("Carrier\n");
-                }
-            } else if ( is_battleship(value) ) {
-                ds->battleship_lives_left --;
-
-                if ( ds->battleship_lives_left == 0 ) {
-                    printf("You've sunk my battleship!!!\n");
-                } else {
-                    printf("Battleship\n");
-                }
-            } else if ( is_cruiser(value) ) {
-                ds->cruiser_lives_left --;
-
-                if ( ds->cruiser_lives_left == 0 ) {
-                    printf("You've sunk my cruiser!!!\n");
-                } else {
-                    printf("Cruiser\n");
-                }
-            } else if ( is_submarine(value) ) {
-                ds->submarine_lives_left --;
-
-                if ( ds->submarine_lives_left == 0 ) {
-                    printf("You've sunk my submarine!!!\n");
-                } else {
-                    printf("Submarine\n");
-                }
-            } else if ( is_destroyer(value) ) {
-                ds->destroyer_lives_left --;
-
-                if ( ds->destroyer_lives_left == 0 ) {
-                    printf("You've sunk my destroyer!!!\n");
-                } else {
-                    printf("Destroyer\n");
-                }
-            }
+        }
+
+        report_shot(result, "You've sunk my");
+        turn_over = true;
+    }
+
+    *__i = i;
+    *__j = j;
+
+    return result;
+}
 
-        } else { // Then we missed!
+// need a way to attack the players ships. Pass the player turn as the value for the AI to attack
+ShotResult ai_turn(AI * ai, int * __i, int * __j) {
+// start off by randomly attacking the enemy ships and seeing if i get a hit or not.
 
-            printf("Miss!\n");
-            ds->board[i*10 + j] += (MISS + ATTEMPTED);
+    int i = 0, j = 0;
 
+    ShotResult result = ai_take_shot(ai, &i, &j);
+
+    *__i = i;
+    *__j = j;
+
+    printf("%c%d\n", LETTERS[i], j + 1);
+
+    if ( result.outcome != SHOT_MISS ) { // We got a hit!!!
+        puts("");
+        dsleep(0.15);
+    }
+
+    report_shot(result, "AI sunk my");
+
+    return result;
+}
+
+// Prompt the user for the `n` locations of a salvo, then fire all of them. The cells are stored in `cells`.
+// Like ai_choose_salvo, the salvo is cut down to the cells that haven't been tried yet
+SalvoResult player_salvo(DockingStation * ds, int n, int cells[MAX_SALVO]) {
+
+    Bitboard chosen = bb_empty();
+    int untried = BB_CELLS - bb_popcount(ds->board->attempted);
+
+    if (n > MAX_SALVO) n = MAX_SALVO;
+    if (n > untried) n = untried;
+
+    for (int k = 0; k < n; k ++) {
+
+        printf("Shot %d of %d: ", k + 1, n);
+
+        uint64_t start = timing_start();
+        int i = input_row_index();
+        int j = input_col_index();
+        int cell = i * BOARD_SIZE + j;
+        timing_stop(PHASE_INPUT, start);
+
+        if ( bb_test(ds->board->attempted, cell) || bb_test(chosen, cell) ) {
+            printf("You already tried this location, try again\n");
+            k --;
+            continue;
         }
 
-        turn_over = true;
+        bb_set(&chosen, cell);
+        cells[k] = cell;
+    }
+
+    uint64_t start = timing_start();
+    SalvoResult salvo = fire_salvo(ds, cells, n);
+    timing_stop(PHASE_RESOLUTION, start);
+
+    for (int k = 0; k < salvo.num_shots; k ++) {
+        printf("%c%d: ", LETTERS[cells[k] / BOARD_SIZE], cells[k] % BOARD_SIZE + 1);
+        report_shot(salvo.results[k], "You've sunk my");
+    }
+
+    return salvo;
+}
+
+// The AI fires its salvo of `n` shots and every shot is reported
+SalvoResult ai_salvo_turn(AI * ai, int n, int cells[MAX_SALVO]) {
+
+    SalvoResult salvo = ai_take_salvo(ai, n, cells);
+
+    for (int k = 0; k < salvo.num_shots; k ++) {
+        printf("%c%d: ", LETTERS[cells[k] / BOARD_SIZE], cells[k] % BOARD_SIZE + 1);
+        report_shot(salvo.results[k], "AI sunk my");
+        dsleep(0.15);
     }
+
+    return salvo;
 }
 
 int input_valid_directions(char * valid_directions, int num_valid_directions) {
@@ -224,65 +294,6 @@ int input_valid_directions(char * valid_directions, int num_valid_directions) {
 
 }
 
-char * get_valid_directions(Board board, int irow, int jcol, int ship_length, int * num_valid_directions) {
-// implement this please
-// When given the size of a ship, and an index irow, jcol, and the address of a var to store the number
-// of valid directions, return a character pointer that contains the valid directions
-
-
-
-    *num_valid_directions = 0;
-    bool valid_directions_long[4] = {false};
-    char dummy = 'c';
-
-    // printf("ENTERED GET_VALID_DIRECTIONS...\n");
-
-    // get the number of valid directions
-    for(int i = 0; i < 4; i ++) {
-
-        // printf("VALIDATING_PLACEMENT of: %c \n", DIRECTIONS[i]);
-
-        if ( validate_placement(irow, jcol, DIRECTIONS[i], board, ship_length) ) {
-
-            // printf("DIRECTION %c is valid!\n", DIRECTIONS[i]);
-            (*num_valid_directions) ++;
-            valid_directions_long[i] = true;
-
-        }
-    }
-
-    // printf("Validated all directions!!\n");
-    // printf("Num valid directions: %d\n", *num_valid_directions);
-
-    // malloc the characters
-    char * valid_directions = (char*) malloc( sizeof(dummy) * (*num_valid_directions) ); // allocate 'num_valid_directions' characters
-    // if (valid_directions) {
-        // printf("valid_directions initialized correctly?\n");
-    // }
-
-    int j_valid_direction = 0; // index of valid direction to input
-    for(int i = 0; i < 4; i ++) {
-
-        // printf("valid_directions_long[%d]: %d\n", i, valid_directions_long[i]);
-
-        if ( valid_directions_long[i] ) {
-
-            // printf("Storing direction: %c\n", DIRECTIONS[i]);
-            valid_directions[j_valid_direction] = DIRECTIONS[i];
-            j_valid_direction ++;
-        }
-    }
-
-    // printf("Finished fetching valid directions!!\n");
-
-    // printf("Address of valid_directions: %x\n", valid_directions);
-
-    // printf("Character at valid_directions[0] = %c\n", valid_directions[0]);
-    // printf("Character at valid_directions[1] = %c\n", valid_directions[1]);
-
-    return valid_directions;
-}
-
 void get_player_placement(DockingStation * ds) {
 // Receive and validate player placement of all 5 ships
 
@@ -291,7 +302,7 @@ void get_player_placement(DockingStation * ds) {
     uint32_t irow = 0;
     uint32_t jcol = 0;
 
-    char * valid_directions = NULL;
+    char valid_directions[4];
     int num_valid_directions = 0;
     // char direction_selected;
     int dir_selected_int = 0;
@@ -309,7 +320,7 @@ void get_player_placement(DockingStation * ds) {
 
             irow = input_row_index();
             jcol = input_col_index();
-            valid_directions = get_valid_directions(ds->board, irow, jcol, SHIP_LENGTHS[i], &num_valid_directions);
+            num_valid_directions = list_valid_directions(ds->board, irow, jcol, SHIP_LENGTHS[i], valid_directions);
 
             if ( num_valid_directions == 0 ) {
                 fflush(stdout);
@@ -319,8 +330,6 @@ void get_player_placement(DockingStation * ds) {
 
         }
 
-        // get_valid_directions(ds->board, irow, jcol, SHIP_LENGTHS[i], &num_valid_directions);
-
         printf("Valid directions: ");
 
         for (int j = 0; j < num_valid_directions; j ++) {
@@ -346,12 +355,5 @@ void get_player_placement(DockingStation * ds) {
 
 }
 
-bool is_game_over(DockingStation ds) {
-
-    return (ds.carrier_lives_left == 0 && ds.battleship_lives_left == 0 && ds.cruiser_lives_left == 0 &&
-            ds.submarine_lives_left == 0 && ds.destroyer_lives_left == 0);
-}
-
-
 #endif
 
@@ -0,0 +1,130 @@
+#ifndef BATTLESHIP_CONFIG
+#define BATTLESHIP_CONFIG
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "battleship_board.h"
+
+// Board of the tournament's stress games. The game itself is fixed at compile time (BOARD_SIZE and
+// SHIP_LENGTHS of battleship_board.h) and so are all of its AIs; a configuration other than the classic
+// one is only played by the stress harness, on a Field (battleship_field.h) with the strategies of
+// battleship_field_ai.h.
+
+#define MAX_FIELD_SIZE 1024
+#define MAX_FIELD_SHIPS 4096
+
+typedef struct BoardConfig {
+
+    int rows;
+    int cols;
+    int num_ships;
+    int * ship_lengths; // malloc'd, num_ships entries
+
+} BoardConfig;
+
+BoardConfig classic_config() {
+
+    BoardConfig config = {BOARD_SIZE, BOARD_SIZE, NUM_SHIPS, (int *) malloc(sizeof(int) * NUM_SHIPS)};
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+        config.ship_lengths[s] = SHIP_LENGTHS[s];
+    }
+
+    return config;
+}
+
+void free_config(BoardConfig * config) {
+    free(config->ship_lengths);
+    config->ship_lengths = NULL;
+}
+
+bool is_classic_config(const BoardConfig * config) {
+
+    if (config->rows != BOARD_SIZE || config->cols != BOARD_SIZE || config->num_ships != NUM_SHIPS) {
+        return false;
+    }
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+        if (config->ship_lengths[s] != SHIP_LENGTHS[s]) return false;
+    }
+
+    return true;
+}
+
+// Parse a configuration of the form "ROWSxCOLS:LENGTHS" where LENGTHS is a comma separated list of ship
+// lengths, each one optionally followed by "*COUNT" to repeat it. For example the classic game is
+// "10x10:5,4,3,3,2" and "1024x1024:5*100,4*100,3*200,2*100" is a 500 ship stress game.
+// Returns false (and prints why) if the string is malformed, the configuration is out of bounds or the
+// ships cover more cells than the board has. A fleet that passes may still not fit in some arrangement:
+// field_place_fleet_random reports it
+bool parse_config(const char * spec, BoardConfig * config) {
+
+    int consumed = 0;
+
+    config->ship_lengths = NULL;
+    config->num_ships = 0;
+
+    if (sscanf(spec, "%dx%d:%n", &config->rows, &config->cols, &consumed) != 2 || consumed == 0) {
+        printf("Board configuration '%s' is not of the form ROWSxCOLS:LENGTHS\n", spec);
+        return false;
+    }
+
+    if (config->rows < 1 || config->cols < 1 || config->rows > MAX_FIELD_SIZE || config->cols > MAX_FIELD_SIZE) {
+        printf("Board dimensions must be in [1, %d]\n", MAX_FIELD_SIZE);
+        return false;
+    }
+
+    config->ship_lengths = (int *) malloc(sizeof(int) * MAX_FIELD_SHIPS);
+
+    const char * c = spec + consumed;
+
+    while (*c != '\0') {
+
+        int length = 0, count = 1, n = 0;
+
+        if (sscanf(c, "%d%n", &length, &n) != 1) break;
+        c += n;
+
+        if (*c == '*') {
+            if (sscanf(c + 1, "%d%n", &count, &n) != 1) break;
+            c += n + 1;
+        }
+
+        if (length < 1 || length > (config->rows > config->cols ? config->rows : config->cols) ||
+            count < 1 || config->num_ships + count > MAX_FIELD_SHIPS) {
+            printf("Invalid ship length %d (x%d), at most %d ships that fit on the board\n", length, count, MAX_FIELD_SHIPS);
+            free_config(config);
+            return false;
+        }
+
+        for (int k = 0; k < count; k ++) {
+            config->ship_lengths[config->num_ships ++] = length;
+        }
+
+        if (*c == ',') c ++;
+    }
+
+    if (*c != '\0' || config->num_ships == 0) {
+        printf("Could not read the list of ship lengths in '%s'\n", spec);
+        free_config(config);
+        return false;
+    }
+
+    long ship_cells = 0;
+
+    for (int s = 0; s < config->num_ships; s ++) {
+        ship_cells += config->ship_lengths[s];
+    }
+
+    if (ship_cells > (long) config->rows * config->cols) {
+        printf("The ships cover %ld cells, more than the %d cells of the board\n", ship_cells, config->rows * config->cols);
+        free_config(config);
+        return false;
+    }
+
+    return true;
+}
+
+#endif
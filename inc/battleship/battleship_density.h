@@ -0,0 +1,170 @@
+#ifndef BATTLESHIP_DENSITY
+#define BATTLESHIP_DENSITY
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "battleship_board.h"
+#include "battleship_engine.h"
+#include "battleship_placements.h"
+
+// Probability density targeting.
+//
+// Every placement of every ship is enumerated once (battleship_placements.h). A DensityMap remembers which
+// placements are still consistent with what we observed on the enemy board:
+//
+//  - a miss kills every placement that covers the cell
+//  - a hit on ship s kills the placements of the other ships that cover the cell, and the placements
+//    of s that do NOT cover it (s has to go through all of its hits)
+//  - a sunk ship is removed altogether
+//
+// For each ship we keep count[s][c], the number of live placements of s covering the cell c, and
+// total[s], the number of live placements of s. The probability that c holds part of s is then
+// count[s][c] / total[s] and we fire at the untried cell with the highest expected number of ships
+// sum_s count[s][c] / total[s]. A ship that has been hit only has a handful of placements left, so the
+// cells around a hit naturally get the highest density.
+//
+// Observations only touch the placements that go through the cell that was shot at (or, on a hit, the
+// placements of the ship that was hit), so the map is updated incrementally instead of being recomputed.
+
+typedef struct DensityMap {
+
+    bool ready;
+    uint8_t sunk;                       // bit s is set once SHIP_TYPES[s] has been sunk
+    Bitboard tried;                     // cells that we already fired at
+    int total[5];                       // live placements of each ship
+    int16_t count[5][BB_CELLS];         // live placements of each ship going through each cell
+    bool alive[MAX_PLACEMENTS];
+
+} DensityMap;
+
+void density_reset(DensityMap * map) {
+
+    init_placement_table();
+    PlacementTable * t = &PLACEMENT_TABLE;
+
+    map->sunk = 0;
+    map->tried = bb_empty();
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        map->total[s] = t->ship_start[s + 1] - t->ship_start[s];
+
+        for (int c = 0; c < BB_CELLS; c ++) {
+            map->count[s][c] = 0;
+        }
+    }
+
+    for (int p = 0; p < t->num_placements; p ++) {
+
+        Placement * pl = &t->placements[p];
+        map->alive[p] = true;
+
+        for (int n = 0; n < pl->length; n ++) {
+            map->count[pl->ship][pl->cells[n]] ++;
+        }
+    }
+
+    map->ready = true;
+}
+
+void density_kill(DensityMap * map, int p) {
+
+    if ( !map->alive[p] ) return;
+
+    Placement * pl = &PLACEMENT_TABLE.placements[p];
+
+    map->alive[p] = false;
+    map->total[pl->ship] --;
+
+    for (int n = 0; n < pl->length; n ++) {
+        map->count[pl->ship][pl->cells[n]] --;
+    }
+}
+
+// Update the map with the outcome of a shot at `cell`
+void density_observe(DensityMap * map, int cell, ShotResult result) {
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+
+    if ( result.outcome == SHOT_INVALID ) return;
+
+    bb_set(&map->tried, cell);
+
+    int hit_ship = result.outcome == SHOT_MISS ? -1 : result.ship;
+
+    // nothing but the ship that was hit can go through this cell
+    for (int k = 0; k < t->cell_count[cell]; k ++) {
+
+        int p = t->cell_placements[cell][k];
+
+        if ( t->placements[p].ship != hit_ship ) {
+            density_kill(map, p);
+        }
+    }
+
+    if ( hit_ship == -1 ) return;
+
+    if ( result.outcome == SHOT_SUNK ) {
+
+        map->sunk |= 1 << hit_ship;
+
+        for (int p = t->ship_start[hit_ship]; p < t->ship_start[hit_ship + 1]; p ++) {
+            density_kill(map, p);
+        }
+
+    } else {
+
+        // the ship that was hit has to cover the cell
+        for (int p = t->ship_start[hit_ship]; p < t->ship_start[hit_ship + 1]; p ++) {
+            if ( map->alive[p] && !bb_test(t->placements[p].mask, cell) ) {
+                density_kill(map, p);
+            }
+        }
+    }
+}
+
+// Expected number of ships covering each cell
+void density_probabilities(const DensityMap * map, float prob[BB_CELLS]) {
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+        prob[c] = 0;
+    }
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        if ( (map->sunk >> s) & 1 || map->total[s] == 0 ) continue;
+
+        float inv_total = 1.0f / map->total[s];
+
+        for (int c = 0; c < BB_CELLS; c ++) {
+            prob[c] += map->count[s][c] * inv_total;
+        }
+    }
+}
+
+// Cell outside of `tried` with the highest probability, -1 if every cell has been tried
+int density_pick(const float prob[BB_CELLS], Bitboard tried) {
+
+    int best = -1;
+    float best_prob = -1;
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+        if ( prob[c] > best_prob && !bb_test(tried, c) ) {
+            best = c;
+            best_prob = prob[c];
+        }
+    }
+
+    return best;
+}
+
+// Untried cell with the highest density, -1 if every cell has been tried
+int density_best_cell(const DensityMap * map) {
+
+    float prob[BB_CELLS];
+    density_probabilities(map, prob);
+
+    return density_pick(prob, map->tried);
+}
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef BATTLESHIP_ENGINE
+#define BATTLESHIP_ENGINE
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "battleship_board.h"
+
+// Headless game engine: every function in here only mutates game state and never reads from stdin,
+// prints or sleeps. The cli (battleship_cli.h) is a thin frontend that calls into the engine and then
+// reports what happened.
+
+typedef enum ShotOutcome {
+
+    SHOT_INVALID,   // out of the board or already attempted, nothing was changed
+    SHOT_MISS,
+    SHOT_HIT,
+    SHOT_SUNK,      // hit that sunk the ship
+
+} ShotOutcome;
+
+typedef struct ShotResult {
+
+    ShotOutcome outcome;
+    int ship;           // index in SHIP_TYPES of the ship that was hit, -1 if we didn't hit anything
+    bool game_over;     // true if this shot sunk the last ship of the fleet
+
+} ShotResult;
+
+bool is_on_board(int i, int j) {
+    return i >= 0 && i < BOARD_SIZE && j >= 0 && j < BOARD_SIZE;
+}
+
+/**========================================================================
+ *                           Placement
+ *========================================================================**/
+
+// Return a 4 bit mask whose bit d is set if a ship of length `ship_length` can be placed starting at (irow, jcol)
+// and extending towards DIRECTIONS[d]
+uint8_t get_valid_directions(Board board, int irow, int jcol, int ship_length) {
+
+    if ( !is_on_board(irow, jcol) || ship_length < 0 || ship_length > MAX_SHIP_LENGTH ) {
+        return 0;
+    }
+
+    const Bitboard * masks = PLACEMENT_MASKS[ship_length][irow*BOARD_SIZE + jcol];
+    Bitboard occupied = board->occupied;
+
+    // an empty mask means that the ship doesn't fit on the board in that direction
+    return  (!bb_is_empty(masks[0]) && !bb_intersects(masks[0], occupied))       |
+            (!bb_is_empty(masks[1]) && !bb_intersects(masks[1], occupied)) << 1  |
+            (!bb_is_empty(masks[2]) && !bb_intersects(masks[2], occupied)) << 2  |
+            (!bb_is_empty(masks[3]) && !bb_intersects(masks[3], occupied)) << 3;
+}
+
+// Return the number of directions in which a ship of length `ship_length` can be placed starting
+// at (irow, jcol). The first `num_valid_directions` entries of `valid_directions` are filled with
+// the corresponding characters of DIRECTIONS
+int list_valid_directions(Board board, int irow, int jcol, int ship_length, char valid_directions[4]) {
+
+    uint8_t bits = get_valid_directions(board, irow, jcol, ship_length);
+    int num_valid_directions = 0;
+
+    for (int d = 0; d < 4; d ++) {
+        valid_directions[num_valid_directions] = DIRECTIONS[d];
+        num_valid_directions += (bits >> d) & 1;
+    }
+
+    return num_valid_directions;
+}
+
+// Validate and place the ship SHIP_TYPES[ship]. Returns false and leaves the board untouched
+// if the placement is not valid
+bool deploy_ship(DockingStation * ds, int i, int j, char direction, int ship) {
+
+    if ( ship < 0 || ship >= NUM_SHIPS || !validate_placement(i, j, direction, ds->board, SHIP_LENGTHS[ship]) ) {
+        return false;
+    }
+
+    place_ship(i, j, direction, ds->board, SHIP_TYPES[ship], SHIP_LENGTHS[ship]);
+    return true;
+}
+
+/**========================================================================
+ *                           Shooting
+ *========================================================================**/
+
+ShotResult fire(DockingStation * ds, int i, int j) {
+
+    ShotResult result = {SHOT_INVALID, -1, false};
+
+    if ( !is_on_board(i, j) || bb_test(ds->board->attempted, i*BOARD_SIZE + j) ) {
+        return result;
+    }
+
+    int cell = i*BOARD_SIZE + j;
+    int ship = ds->board->ship_at[cell];
+
+    mark_shot(ds->board, i, j);
+
+    if ( ship < 0 ) {
+        result.outcome = SHOT_MISS;
+        return result;
+    }
+
+    uint8_t sunk = (-- ds->lives[ship] == 0) << ship;
+
+    ds->sunk |= sunk;
+
+    result.ship = ship;
+    result.outcome = sunk ? SHOT_SUNK : SHOT_HIT;
+    result.game_over = ds->sunk == ALL_SHIPS_SUNK;
+
+    return result;
+}
+
+bool is_game_over(DockingStation ds) {
+    return ds.sunk == ALL_SHIPS_SUNK;
+}
+
+/**========================================================================
+ *                           Salvo
+ *========================================================================**/
+
+// In a salvo game each side fires one shot per ship that it still has afloat, all of them at once, and
+// only learns how they went once the whole salvo has landed.
+
+#define MAX_SALVO 5
+
+typedef struct SalvoResult {
+
+    int num_shots;
+    ShotResult results[MAX_SALVO];  // outcome of each shot, in the order they were given
+    uint8_t sunk;                   // ships sunk by this salvo, bit s for SHIP_TYPES[s]
+    bool game_over;
+
+} SalvoResult;
+
+// Shots that the owner of `ds` may fire in its next salvo
+static inline int salvo_size(const DockingStation * ds) {
+    return NUM_SHIPS - __builtin_popcount(ds->sunk);
+}
+
+// Resolve a whole salvo of `n` cells (i * BOARD_SIZE + j) against `ds`. The cells are checked and the
+// board masks updated once for the whole salvo, then each shot costs a lookup in ship_at and a
+// decrement. A cell that is off the board, already attempted or repeated in the salvo is SHOT_INVALID.
+// The results are the ones that firing the valid shots one by one would give
+SalvoResult fire_salvo(DockingStation * ds, const int * cells, int n) {
+
+    SalvoResult salvo = {n < MAX_SALVO ? n : MAX_SALVO, {{0}}, 0, false};
+    Board board = ds->board;
+    Bitboard shots = bb_empty();
+
+    for (int k = 0; k < salvo.num_shots; k ++) {
+
+        int cell = cells[k];
+        ShotResult * result = &salvo.results[k];
+
+        *result = (ShotResult) {SHOT_INVALID, -1, false};
+
+        if ( cell < 0 || cell >= BB_CELLS || bb_test(board->attempted, cell) || bb_test(shots, cell) ) continue;
+
+        bb_set(&shots, cell);
+
+        int ship = board->ship_at[cell];
+
+        if ( ship < 0 ) {
+            result->outcome = SHOT_MISS;
+            continue;
+        }
+
+        uint8_t sunk = (-- ds->lives[ship] == 0) << ship;
+
+        salvo.sunk |= sunk;
+        result->ship = ship;
+        result->outcome = sunk ? SHOT_SUNK : SHOT_HIT;
+        result->game_over = sunk && (ds->sunk | salvo.sunk) == ALL_SHIPS_SUNK;
+    }
+
+    board->attempted = bb_or(board->attempted, shots);
+    board->hit = bb_or(board->hit, bb_and(shots, board->occupied));
+    board->miss = bb_or(board->miss, bb_andnot(shots, board->occupied));
+
+    ds->sunk |= salvo.sunk;
+    salvo.game_over = ds->sunk == ALL_SHIPS_SUNK;
+
+    return salvo;
+}
+
+#endif
@@ -0,0 +1,234 @@
+#ifndef BATTLESHIP_FIELD
+#define BATTLESHIP_FIELD
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "battleship_config.h"
+#include "battleship_bitset.h"
+#include "battleship_engine.h"
+#include "battleship_rng.h"
+
+// Headless engine of the tournament's stress games, for a board of any size (up to MAX_FIELD_SIZE x
+// MAX_FIELD_SIZE) with any fleet. It mirrors battleship_engine.h: occupancy, attempts and hits are word
+// packed BitSets, ship_at maps an occupied cell to the index of its ship so that a hit is resolved in
+// O(1), and ShotResult.ship is the index of the ship in the BoardConfig.
+
+typedef struct FieldShip {
+
+    int cell;           // first cell (i * cols + j), the ship extends towards the East or the South
+    char direction;     // 'E' or 'S', 0 while the ship hasn't been placed
+    int length;
+    int lives_left;
+
+} FieldShip;
+
+typedef struct Field {
+
+    int rows;
+    int cols;
+    int num_cells;
+    int num_ships;
+    int ships_left;     // ships that haven't been sunk yet
+    BitSet occupied;
+    BitSet attempted;
+    BitSet hit;
+    int32_t * ship_at;  // index of the ship covering each cell, -1 for water
+    FieldShip * ships;
+
+} Field;
+
+Field field_new(const BoardConfig * config) {
+
+    Field f;
+
+    f.rows = config->rows;
+    f.cols = config->cols;
+    f.num_cells = config->rows * config->cols;
+    f.num_ships = config->num_ships;
+    f.occupied = bitset_new(f.num_cells);
+    f.attempted = bitset_new(f.num_cells);
+    f.hit = bitset_new(f.num_cells);
+    f.ship_at = (int32_t *) malloc(sizeof(int32_t) * f.num_cells);
+    f.ships = (FieldShip *) malloc(sizeof(FieldShip) * f.num_ships);
+
+    for (int s = 0; s < f.num_ships; s ++) {
+        f.ships[s].length = config->ship_lengths[s];
+        f.ships[s].direction = 0;
+    }
+
+    for (int c = 0; c < f.num_cells; c ++) {
+        f.ship_at[c] = -1;
+    }
+
+    f.ships_left = f.num_ships;
+
+    return f;
+}
+
+void field_free(Field * f) {
+
+    bitset_free(&f->occupied);
+    bitset_free(&f->attempted);
+    bitset_free(&f->hit);
+    free(f->ship_at);
+    free(f->ships);
+}
+
+// Remove every ship and every shot so that the field can be reused
+void field_reset(Field * f) {
+
+    // only the cells of the ships that were placed need to be cleared in ship_at
+    for (int s = 0; s < f->num_ships; s ++) {
+
+        FieldShip * ship = &f->ships[s];
+        int step = ship->direction == 'E' ? 1 : f->cols;
+
+        for (int n = 0; ship->direction && n < ship->length; n ++) {
+            f->ship_at[ship->cell + n * step] = -1;
+        }
+
+        ship->direction = 0;
+    }
+
+    bitset_clear_all(&f->occupied);
+    bitset_clear_all(&f->attempted);
+    bitset_clear_all(&f->hit);
+
+    f->ships_left = f->num_ships;
+}
+
+// Bring a placement towards 'N' or 'W' back to the equivalent placement towards 'S' or 'E'. Returns
+// false if the ship doesn't fit on the board
+bool field_normalize_placement(const Field * f, int * i, int * j, char * direction, int length) {
+
+    switch (*direction) {
+        case 'N': *i -= length - 1; *direction = 'S'; break;
+        case 'W': *j -= length - 1; *direction = 'E'; break;
+        case 'E': case 'S': break;
+        default: return false;
+    }
+
+    if (*i < 0 || *j < 0) return false;
+
+    return *direction == 'E' ? (*i < f->rows && *j + length <= f->cols) : (*j < f->cols && *i + length <= f->rows);
+}
+
+bool field_is_free(const Field * f, int cell, char direction, int length) {
+
+    if (direction == 'E') {
+        return !bitset_any_in_range(&f->occupied, cell, length);
+    }
+
+    for (int n = 0; n < length; n ++) {
+        if ( bitset_test(&f->occupied, cell + n * f->cols) ) return false;
+    }
+
+    return true;
+}
+
+bool field_validate_placement(const Field * f, int i, int j, char direction, int length) {
+
+    if ( !field_normalize_placement(f, &i, &j, &direction, length) ) return false;
+
+    return field_is_free(f, i * f->cols + j, direction, length);
+}
+
+// Validate and place the ship `ship`, same contract as deploy_ship
+bool field_place_ship(Field * f, int i, int j, char direction, int ship) {
+
+    if (ship < 0 || ship >= f->num_ships || f->ships[ship].direction) return false;
+
+    FieldShip * s = &f->ships[ship];
+
+    if ( !field_normalize_placement(f, &i, &j, &direction, s->length) ) return false;
+
+    int cell = i * f->cols + j;
+
+    if ( !field_is_free(f, cell, direction, s->length) ) return false;
+
+    int step = direction == 'E' ? 1 : f->cols;
+
+    for (int n = 0; n < s->length; n ++) {
+        bitset_set(&f->occupied, cell + n * step);
+        f->ship_at[cell + n * step] = ship;
+    }
+
+    s->cell = cell;
+    s->direction = direction;
+    s->lives_left = s->length;
+
+    return true;
+}
+
+// Place every ship at random. Each ship first tries a few random placements; if they all collide, the
+// placements are scanned from a random starting point so that a ship is always placed when it fits
+// somewhere. Returns false if some ship couldn't be placed at all
+bool field_place_fleet_random(Field * f, XoshiroState * rng) {
+
+    for (int s = 0; s < f->num_ships; s ++) {
+
+        bool placed = false;
+
+        for (int attempt = 0; attempt < 64 && !placed; attempt ++) {
+
+            char direction = xoshiro_below(rng, 2) ? 'E' : 'S';
+            int i = (int) xoshiro_below(rng, f->rows);
+            int j = (int) xoshiro_below(rng, f->cols);
+
+            placed = field_place_ship(f, i, j, direction, s);
+        }
+
+        int start = (int) xoshiro_below(rng, 2 * f->num_cells);
+
+        for (int k = 0; k < 2 * f->num_cells && !placed; k ++) {
+
+            int p = (start + k) % (2 * f->num_cells);
+            int cell = p >> 1;
+
+            placed = field_place_ship(f, cell / f->cols, cell % f->cols, p & 1 ? 'S' : 'E', s);
+        }
+
+        if (!placed) return false;
+    }
+
+    return true;
+}
+
+ShotResult field_fire(Field * f, int i, int j) {
+
+    ShotResult result = {SHOT_INVALID, -1, false};
+
+    if (i < 0 || j < 0 || i >= f->rows || j >= f->cols) return result;
+
+    int cell = i * f->cols + j;
+
+    if ( bitset_test(&f->attempted, cell) ) return result;
+
+    bitset_set(&f->attempted, cell);
+
+    int ship = f->ship_at[cell];
+
+    if (ship == -1) {
+        result.outcome = SHOT_MISS;
+        return result;
+    }
+
+    bitset_set(&f->hit, cell);
+
+    result.ship = ship;
+    result.outcome = -- f->ships[ship].lives_left == 0 ? SHOT_SUNK : SHOT_HIT;
+
+    if (result.outcome == SHOT_SUNK) {
+        f->ships_left --;
+        result.game_over = f->ships_left == 0;
+    }
+
+    return result;
+}
+
+bool field_is_game_over(const Field * f) {
+    return f->ships_left == 0;
+}
+
+#endif
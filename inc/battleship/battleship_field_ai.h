@@ -0,0 +1,495 @@
+#ifndef BATTLESHIP_FIELD_AI
+#define BATTLESHIP_FIELD_AI
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "battleship_field.h"
+
+// Strategies of the tournament's stress harness, for a Field of any size.
+//
+// These are not the AIs of battleship_ai.h and their results don't stand for them: a stress game measures
+// how this harness scales with the board, the AI_DENSITY and AI_MONTE_CARLO AIs only play on the classic
+// board. Hence the strategies have names of their own.
+//
+// FIELD_RANDOM keeps the untried cells in a swap-remove array, exactly like UntriedCells.
+//
+// FIELD_HUNT_TARGET has two modes. While no ship is hit but not sunk ("hunt"), the score of a cell is the
+// number of placements of the remaining ship lengths that cover it and only go through untried cells.
+// Ships of the same length are interchangeable, so the counts are kept per distinct length and a shot
+// only updates the placements that go through the cell that was shot at. The scores live in a max
+// segment tree, so the best cell is found in O(log cells) even on a 1024x1024 board. Once a ship has
+// been hit ("target"), we only consider the placements of that ship (its length is known) that cover
+// all of its hits and fire at the untried cell covered by the most of them. Unlike AI_DENSITY, which
+// weighs every ship by its own live placements, hunt scores are raw counts per length and a ship that
+// was hit is finished off before anything else is considered.
+
+typedef enum FieldStrategy {
+
+    FIELD_RANDOM,
+    FIELD_HUNT_TARGET,
+
+} FieldStrategy;
+
+const char * FIELD_STRATEGY_NAMES[] = {"random", "hunttarget"};
+const int NUM_FIELD_STRATEGIES = 2;
+
+// Return the strategy whose name is `name`, or -1 if there is no such strategy
+int field_strategy_from_name(const char * name) {
+
+    for (int i = 0; i < NUM_FIELD_STRATEGIES; i ++) {
+        if ( strcmp(name, FIELD_STRATEGY_NAMES[i]) == 0 ) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+typedef struct FieldAI {
+
+    Field * target;         // the field that we are shooting at
+    FieldStrategy strategy;
+    XoshiroState * rng;
+
+    // FIELD_RANDOM
+    int untried_count;
+    int32_t * untried;
+    int32_t * untried_pos;
+
+    // FIELD_HUNT_TARGET, hunt mode
+    int num_lengths;
+    int * lengths;          // distinct ship lengths
+    int * length_left;      // number of ships of each length that aren't sunk
+    int * length_of_ship;   // index in `lengths` of each ship
+    int32_t * count;        // count[k * num_cells + c]: placements of lengths[k] covering c
+    BitSet tried;
+    BitSet dirty;
+    int32_t * dirty_cells;
+    int tree_leaves;
+    int64_t * tree;         // max segment tree of the hunt scores, -1 for tried cells
+
+    // FIELD_HUNT_TARGET, target mode
+    int32_t * hit_ship_at;  // ship that we hit at each cell, -1 if we didn't hit anything there
+    int * hits;             // number of hits on each ship
+    int * first_hit;        // cell of the first hit on each ship
+    int num_open;
+    int * open_ships;       // ships that were hit but aren't sunk yet, in the order they were found
+    int32_t * span_score;
+
+} FieldAI;
+
+FieldAI field_ai_new(Field * target, FieldStrategy strategy, XoshiroState * rng) {
+
+    FieldAI ai;
+    int n = target->num_cells;
+    int max_length = 1;
+
+    ai.target = target;
+    ai.strategy = strategy;
+    ai.rng = rng;
+
+    ai.untried = (int32_t *) malloc(sizeof(int32_t) * n);
+    ai.untried_pos = (int32_t *) malloc(sizeof(int32_t) * n);
+
+    ai.lengths = (int *) malloc(sizeof(int) * target->num_ships);
+    ai.length_left = (int *) malloc(sizeof(int) * target->num_ships);
+    ai.length_of_ship = (int *) malloc(sizeof(int) * target->num_ships);
+    ai.num_lengths = 0;
+
+    for (int s = 0; s < target->num_ships; s ++) {
+
+        int length = target->ships[s].length;
+        int k = 0;
+
+        while (k < ai.num_lengths && ai.lengths[k] != length) k ++;
+        if (k == ai.num_lengths) ai.lengths[ai.num_lengths ++] = length;
+
+        ai.length_of_ship[s] = k;
+        if (length > max_length) max_length = length;
+    }
+
+    ai.count = (int32_t *) malloc(sizeof(int32_t) * ai.num_lengths * n);
+    ai.tried = bitset_new(n);
+    ai.dirty = bitset_new(n);
+    ai.dirty_cells = (int32_t *) malloc(sizeof(int32_t) * n);
+
+    for (ai.tree_leaves = 1; ai.tree_leaves < n; ai.tree_leaves <<= 1);
+    ai.tree = (int64_t *) malloc(sizeof(int64_t) * 2 * ai.tree_leaves);
+
+    ai.hit_ship_at = (int32_t *) malloc(sizeof(int32_t) * n);
+    ai.hits = (int *) malloc(sizeof(int) * target->num_ships);
+    ai.first_hit = (int *) malloc(sizeof(int) * target->num_ships);
+    ai.open_ships = (int *) malloc(sizeof(int) * target->num_ships);
+    ai.span_score = (int32_t *) malloc(sizeof(int32_t) * 2 * (2 * max_length - 1));
+
+    return ai;
+}
+
+void field_ai_free(FieldAI * ai) {
+
+    free(ai->untried);
+    free(ai->untried_pos);
+    free(ai->lengths);
+    free(ai->length_left);
+    free(ai->length_of_ship);
+    free(ai->count);
+    bitset_free(&ai->tried);
+    bitset_free(&ai->dirty);
+    free(ai->dirty_cells);
+    free(ai->tree);
+    free(ai->hit_ship_at);
+    free(ai->hits);
+    free(ai->first_hit);
+    free(ai->open_ships);
+    free(ai->span_score);
+}
+
+/**========================================================================
+ *                           Hunt scores
+ *========================================================================**/
+
+int64_t field_ai_score(const FieldAI * ai, int cell) {
+
+    if ( bitset_test(&ai->tried, cell) ) return -1;
+
+    int64_t score = 0;
+
+    for (int k = 0; k < ai->num_lengths; k ++) {
+        if (ai->length_left[k] > 0) {
+            score += ai->count[k * ai->target->num_cells + cell];
+        }
+    }
+
+    return score;
+}
+
+void field_ai_tree_update(FieldAI * ai, int cell) {
+
+    int node = ai->tree_leaves + cell;
+    ai->tree[node] = field_ai_score(ai, cell);
+
+    for (node >>= 1; node > 0; node >>= 1) {
+        int64_t l = ai->tree[2 * node], r = ai->tree[2 * node + 1];
+        ai->tree[node] = l > r ? l : r;
+    }
+}
+
+void field_ai_tree_rebuild(FieldAI * ai) {
+
+    int n = ai->target->num_cells;
+
+    for (int c = 0; c < ai->tree_leaves; c ++) {
+        ai->tree[ai->tree_leaves + c] = c < n ? field_ai_score(ai, c) : -1;
+    }
+
+    for (int node = ai->tree_leaves - 1; node > 0; node --) {
+        int64_t l = ai->tree[2 * node], r = ai->tree[2 * node + 1];
+        ai->tree[node] = l > r ? l : r;
+    }
+}
+
+// Cell with the highest hunt score, -1 if every cell was tried
+int field_ai_tree_best(const FieldAI * ai) {
+
+    if (ai->tree[1] < 0) return -1;
+
+    int node = 1;
+
+    while (node < ai->tree_leaves) {
+        node = ai->tree[2 * node] == ai->tree[node] ? 2 * node : 2 * node + 1;
+    }
+
+    return node - ai->tree_leaves;
+}
+
+// Number of placements of a ship of `length` covering `cell` in one direction, on an empty line of `size` cells
+// where `cell` sits at position `pos`
+int placements_through(int pos, int size, int length) {
+
+    int lo = pos - length + 1 > 0 ? pos - length + 1 : 0;
+    int hi = pos < size - length ? pos : size - length;
+
+    return hi >= lo ? hi - lo + 1 : 0;
+}
+
+// Remove from the hunt counts every placement that goes through `cell`, which was just fired at
+void field_ai_block(FieldAI * ai, int cell) {
+
+    Field * f = ai->target;
+    int n = f->num_cells;
+    int row = cell / f->cols, col = cell % f->cols;
+    int num_dirty = 0;
+
+    for (int k = 0; k < ai->num_lengths; k ++) {
+
+        int length = ai->lengths[k];
+        int32_t * count = ai->count + (size_t) k * n;
+
+        for (int d = 0; d < 2; d ++) {
+
+            int step = d == 0 ? 1 : f->cols;
+            int pos = d == 0 ? col : row;
+            int size = d == 0 ? f->cols : f->rows;
+
+            for (int t = 0; t < length; t ++) {
+
+                int first = pos - t; // position of the first cell of the placement along the line
+
+                if (first < 0 || first + length > size) continue;
+
+                int start = cell - t * step;
+                bool alive = true;
+
+                // a placement is alive as long as all of its cells are untried
+                if (d == 0) {
+                    alive = !bitset_any_in_range(&ai->tried, start, length);
+                } else {
+                    for (int m = 0; m < length && alive; m ++) {
+                        alive = !bitset_test(&ai->tried, start + m * step);
+                    }
+                }
+
+                if (!alive) continue;
+
+                for (int m = 0; m < length; m ++) {
+
+                    int x = start + m * step;
+                    count[x] --;
+
+                    if ( !bitset_test(&ai->dirty, x) ) {
+                        bitset_set(&ai->dirty, x);
+                        ai->dirty_cells[num_dirty ++] = x;
+                    }
+                }
+            }
+        }
+    }
+
+    bitset_set(&ai->tried, cell);
+
+    if ( !bitset_test(&ai->dirty, cell) ) {
+        ai->dirty_cells[num_dirty ++] = cell;
+    }
+
+    for (int i = 0; i < num_dirty; i ++) {
+        bitset_clear(&ai->dirty, ai->dirty_cells[i]);
+        field_ai_tree_update(ai, ai->dirty_cells[i]);
+    }
+}
+
+/**========================================================================
+ *                           Target mode
+ *========================================================================**/
+
+// Best untried cell to finish off `ship`, -1 if no placement is consistent with what we saw
+int field_ai_target(FieldAI * ai, int ship) {
+
+    Field * f = ai->target;
+    int length = f->ships[ship].length;
+    int h = ai->first_hit[ship];
+    int row = h / f->cols, col = h % f->cols;
+    int width = 2 * length - 1; // cells at offsets -(length - 1) .. (length - 1) of the first hit
+
+    for (int i = 0; i < 2 * width; i ++) {
+        ai->span_score[i] = 0;
+    }
+
+    for (int d = 0; d < 2; d ++) {
+
+        int step = d == 0 ? 1 : f->cols;
+        int pos = d == 0 ? col : row;
+        int size = d == 0 ? f->cols : f->rows;
+
+        for (int t = 0; t < length; t ++) {
+
+            int first = pos - t;
+
+            if (first < 0 || first + length > size) continue;
+
+            int start = h - t * step;
+            int hits = 0;
+            bool valid = true;
+
+            // the ship can only go through untried cells and its own hits, and has to cover all of them
+            for (int m = 0; m < length && valid; m ++) {
+
+                int x = start + m * step;
+
+                if ( bitset_test(&ai->tried, x) ) {
+                    valid = ai->hit_ship_at[x] == ship;
+                    hits += valid;
+                }
+            }
+
+            if (!valid || hits != ai->hits[ship]) continue;
+
+            for (int m = 0; m < length; m ++) {
+                ai->span_score[d * width + (m - t) + length - 1] ++;
+            }
+        }
+    }
+
+    int best = -1, best_score = 0;
+
+    for (int d = 0; d < 2; d ++) {
+
+        int step = d == 0 ? 1 : f->cols;
+
+        for (int o = -(length - 1); o <= length - 1; o ++) {
+
+            int score = ai->span_score[d * width + o + length - 1];
+
+            if (score > best_score && !bitset_test(&ai->tried, h + o * step)) {
+                best = h + o * step;
+                best_score = score;
+            }
+        }
+    }
+
+    return best;
+}
+
+/**========================================================================
+ *                           Playing
+ *========================================================================**/
+
+// Forget everything about the previous game
+void field_ai_reset(FieldAI * ai) {
+
+    Field * f = ai->target;
+    int n = f->num_cells;
+
+    ai->untried_count = n;
+
+    for (int c = 0; c < n; c ++) {
+        ai->untried[c] = c;
+        ai->untried_pos[c] = c;
+    }
+
+    if (ai->strategy != FIELD_HUNT_TARGET) return;
+
+    for (int k = 0; k < ai->num_lengths; k ++) {
+
+        ai->length_left[k] = 0;
+
+        for (int c = 0; c < n; c ++) {
+            ai->count[(size_t) k * n + c] = placements_through(c % f->cols, f->cols, ai->lengths[k]) +
+                                            placements_through(c / f->cols, f->rows, ai->lengths[k]);
+        }
+    }
+
+    for (int s = 0; s < f->num_ships; s ++) {
+        ai->length_left[ai->length_of_ship[s]] ++;
+        ai->hits[s] = 0;
+    }
+
+    for (int c = 0; c < n; c ++) {
+        ai->hit_ship_at[c] = -1;
+    }
+
+    bitset_clear_all(&ai->tried);
+    bitset_clear_all(&ai->dirty);
+    ai->num_open = 0;
+
+    field_ai_tree_rebuild(ai);
+}
+
+int field_ai_choose(FieldAI * ai) {
+
+    if (ai->strategy == FIELD_HUNT_TARGET) {
+
+        // target the oldest ship that we hit without sinking it
+        for (int k = 0; k < ai->num_open; k ++) {
+
+            int cell = field_ai_target(ai, ai->open_ships[k]);
+            if (cell != -1) return cell;
+        }
+
+        return field_ai_tree_best(ai);
+    }
+
+    return ai->untried[xoshiro_below(ai->rng, ai->untried_count)];
+}
+
+void field_ai_observe(FieldAI * ai, int cell, ShotResult result) {
+
+    if (result.outcome == SHOT_INVALID) return;
+
+    // remove the cell from the untried cells
+    int last = ai->untried[ai->untried_count - 1];
+    int hole = ai->untried_pos[cell];
+
+    ai->untried[hole] = last;
+    ai->untried_pos[last] = hole;
+    ai->untried_count --;
+
+    if (ai->strategy != FIELD_HUNT_TARGET) return;
+
+    field_ai_block(ai, cell);
+
+    if (result.outcome == SHOT_MISS) return;
+
+    int ship = result.ship;
+
+    ai->hit_ship_at[cell] = ship;
+
+    if (ai->hits[ship] ++ == 0) {
+        ai->first_hit[ship] = cell;
+        ai->open_ships[ai->num_open ++] = ship;
+    }
+
+    if (result.outcome == SHOT_SUNK) {
+
+        int k = 0;
+        while (ai->open_ships[k] != ship) k ++;
+
+        for (; k < ai->num_open - 1; k ++) {
+            ai->open_ships[k] = ai->open_ships[k + 1];
+        }
+
+        ai->num_open --;
+
+        // once every ship of a length is sunk, its placements stop counting
+        if (-- ai->length_left[ai->length_of_ship[ship]] == 0) {
+            field_ai_tree_rebuild(ai);
+        }
+    }
+}
+
+ShotResult field_ai_take_shot(FieldAI * ai, int * cell) {
+
+    *cell = field_ai_choose(ai);
+
+    ShotResult result = field_fire(ai->target, *cell / ai->target->cols, *cell % ai->target->cols);
+    field_ai_observe(ai, *cell, result);
+
+    return result;
+}
+
+// Same as ai_vs_ai, for two FieldAIs shooting at each other's field. Returns -1 if a side runs out of
+// untried cells before sinking the other fleet, which only happens when some ship wasn't placed
+int field_ai_vs_ai(FieldAI * first, FieldAI * second, int * winner_shots) {
+
+    FieldAI * players[2] = {first, second};
+    int shots[2] = {0, 0};
+    int turn = 0, cell = 0;
+
+    while (players[turn]->untried_count > 0) {
+
+        ShotResult result = field_ai_take_shot(players[turn], &cell);
+        shots[turn] ++;
+
+        if (result.game_over) {
+            *winner_shots = shots[turn];
+            return turn;
+        }
+
+        turn = 1 - turn;
+    }
+
+    return -1;
+}
+
+#endif
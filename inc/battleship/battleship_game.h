@@ -4,35 +4,89 @@
 #include "battleship_ai.h"
 #include "battleship_board.h"
 #include "battleship_cli.h"
+#include "battleship_engine.h"
+#include "battleship_render.h"
+#include "battleship_timing.h"
 
-void step(DockingStation * player_ds, DockingStation * enemy_ds, AI * ai) {
+FrameBuffer GAME_FRAME = {0};
 
+// Draw both boards, the time it takes is the render phase of the timing report (battleship_timing.h)
+void render_game(DockingStation * player_ds, DockingStation * enemy_ds) {
+
+    uint64_t start = timing_start();
+    render_docking_station(&GAME_FRAME, player_ds, enemy_ds, false);
+    timing_stop(PHASE_RENDER, start);
+}
+
+// The player is side 0 of the record, the AI side 1. `record` may be NULL
+void step(DockingStation * player_ds, DockingStation * enemy_ds, AI * ai, GameRecord * record) {
+
+    int i = 0, j = 0;
+    ShotResult result;
 
     printf("Please make a selection: ");
-    player_turn(enemy_ds);
+    result = player_turn(enemy_ds, &i, &j);
+    record_shot(record, 0, i, j, result);
+    if (result.game_over) return;
+
     dsleep(0.75);
-    clear_screen();
-    print_docking_station(player_ds, enemy_ds);
+    render_game(player_ds, enemy_ds);
     printf("AI's turn\n");
     for (int i = 0; i < 3; i ++) {
         puts(".");
         dsleep(0.25);
     }
 
-    int * ai_selection;
-    ai_turn(ai);
+    result = ai_turn(ai, &i, &j);
+    record_shot(record, 1, i, j, result);
     // printf("AI selection: ");
     // printf("%c%d\n", LETTERS[ai_selection[0]], ai_selection[1] + 1);
     dsleep(1.5);
 
-    clear_screen();
-    print_docking_station(player_ds, enemy_ds);
+    render_game(player_ds, enemy_ds);
     // printf("Enemy screen: \n\n");
     // print_full_board(enemy_ds->board);
 
 }
 
-void play_game(DockingStation * player_ds, DockingStation * enemy_ds) {
+// One turn of each side with salvo rules: every side fires one shot per ship that it still has afloat
+void step_salvo(DockingStation * player_ds, DockingStation * enemy_ds, AI * ai, GameRecord * record) {
+
+    int cells[MAX_SALVO];
+    int n = salvo_size(player_ds);
+
+    printf("Fire your salvo of %d shots\n", n);
+    SalvoResult salvo = player_salvo(enemy_ds, n, cells);
+
+    for (int k = 0; k < salvo.num_shots; k ++) {
+        record_shot(record, 0, cells[k] / BOARD_SIZE, cells[k] % BOARD_SIZE, salvo.results[k]);
+    }
+
+    if (salvo.game_over) return;
+
+    dsleep(1.5);
+    render_game(player_ds, enemy_ds);
+    printf("AI's turn\n");
+    for (int i = 0; i < 3; i ++) {
+        puts(".");
+        dsleep(0.25);
+    }
+
+    salvo = ai_salvo_turn(ai, salvo_size(enemy_ds), cells);
+
+    for (int k = 0; k < salvo.num_shots; k ++) {
+        record_shot(record, 1, cells[k] / BOARD_SIZE, cells[k] % BOARD_SIZE, salvo.results[k]);
+    }
+
+    dsleep(1.5);
+    render_game(player_ds, enemy_ds);
+}
+
+// When `record_path` isn't NULL, the game is appended to it as a GameRecord (see battleship_record.h).
+// The AI draws from its own generator so that the recorded seed and the player's shots are enough to
+// play the game again. When `book` isn't NULL, the AI places its fleet from it. With `salvo`, the game is
+// played with salvo rules (see step_salvo)
+void play_game(DockingStation * player_ds, DockingStation * enemy_ds, const char * record_path, const PlacementBook * book, bool salvo) {
 
     xor_rng rng;
     seed_xoshiro256ss(&rng);
@@ -40,9 +94,20 @@ void play_game(DockingStation * player_ds, DockingStation * enemy_ds) {
 
     // print_xoshiro256ss_state(&XOSHIRO_RNG);
 
+    uint64_t seed = ((uint64_t) unif(0, 0x7FFFFFFF) << 32) ^ (uint64_t) unif(0, 0x7FFFFFFF);
+    XoshiroState ai_rng;
+    xoshiro_seed(&ai_rng, seed);
+
     // dsleep(2.5);
-    AI ai = {0, 0, 0, false, player_ds, enemy_ds};
-    ai_place_ships(&ai);
+    AI ai = {.human_ds = player_ds, .ai_ds = enemy_ds, .strategy = AI_DENSITY, .rng = &ai_rng, .book = book};
+    ai_reset(&ai);
+
+    if ( !ai_place_ships(&ai) ) {
+        printf("[AI]\t could not place its ships, the game can't start\n");
+        return;
+    }
+
+    printf("[AI]\t placed all ships!\n\n");
 
 
     printf("WELCOME TO THE GAME \n\n");
@@ -53,17 +118,29 @@ void play_game(DockingStation * player_ds, DockingStation * enemy_ds) {
 
     get_player_placement(player_ds);
 
+    GameRecord record;
+    record_init(&record, seed, RECORD_HUMAN, AI_DENSITY);
+    record_fleet(&record, 0, player_ds->board);
+    record_fleet(&record, 1, enemy_ds->board);
+
     clear_screen();
 
     printf("Awesome!! Now are you ready to get fucked up by the AI???\n\n");
     dsleep(0.5);
     clear_screen();
-    print_docking_station(player_ds, enemy_ds);
+    render_game(player_ds, enemy_ds);
 
     while ( !is_game_over(*player_ds) && !is_game_over(*enemy_ds)) {
 
-        step(player_ds, enemy_ds, &ai);
+        if (salvo) step_salvo(player_ds, enemy_ds, &ai, record_path ? &record : NULL);
+        else step(player_ds, enemy_ds, &ai, record_path ? &record : NULL);
+
+    }
+
+    frame_free(&GAME_FRAME);
 
+    if (record_path && !record_append(record_path, &record, 1)) {
+        printf("Could not save the game to %s\n", record_path);
     }
 
 }
@@ -0,0 +1,127 @@
+#ifndef BATTLESHIP_LATENCY
+#define BATTLESHIP_LATENCY
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+// Latency histograms.
+//
+// Durations are counted in nanoseconds in log-linear buckets: every power of two is split in
+// LATENCY_SUB_BUCKETS buckets of the same width, so a percentile read back from the histogram is within
+// 1/16 (about 6%) of the exact value, whatever its magnitude, and recording a duration is a couple of
+// shifts and an increment. Histograms are plain arrays of counts: the histograms of several threads or
+// of several reporting periods are merged by adding them.
+
+#define LATENCY_SUB_BITS 4
+#define LATENCY_SUB_BUCKETS (1 << LATENCY_SUB_BITS)
+#define LATENCY_BUCKETS ((64 - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS)
+
+typedef struct LatencyHistogram {
+
+    uint64_t counts[LATENCY_BUCKETS];
+    uint64_t total;         // number of durations recorded
+    uint64_t sum_ns;
+    uint64_t max_ns;
+
+} LatencyHistogram;
+
+static inline uint64_t latency_now_ns() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static inline int latency_bucket(uint64_t ns) {
+
+    if (ns < LATENCY_SUB_BUCKETS) return (int) ns;
+
+    int e = 63 - __builtin_clzll(ns);  // ns lies in [2^e, 2^(e + 1))
+    int sub = (ns >> (e - LATENCY_SUB_BITS)) & (LATENCY_SUB_BUCKETS - 1);
+
+    return (e - LATENCY_SUB_BITS + 1) * LATENCY_SUB_BUCKETS + sub;
+}
+
+// Smallest duration that falls in `bucket`
+static inline uint64_t latency_bucket_start(int bucket) {
+
+    if (bucket < LATENCY_SUB_BUCKETS) return bucket;
+
+    int e = bucket / LATENCY_SUB_BUCKETS + LATENCY_SUB_BITS - 1;
+    uint64_t sub = bucket % LATENCY_SUB_BUCKETS;
+
+    return (LATENCY_SUB_BUCKETS + sub) << (e - LATENCY_SUB_BITS);
+}
+
+void latency_reset(LatencyHistogram * h) {
+    memset(h, 0, sizeof(LatencyHistogram));
+}
+
+static inline void latency_record(LatencyHistogram * h, uint64_t ns) {
+
+    h->counts[latency_bucket(ns)] ++;
+    h->total ++;
+    h->sum_ns += ns;
+    if (ns > h->max_ns) h->max_ns = ns;
+}
+
+// Record `n` requests that all took `ns`
+static inline void latency_record_n(LatencyHistogram * h, uint64_t ns, uint64_t n) {
+
+    h->counts[latency_bucket(ns)] += n;
+    h->total += n;
+    h->sum_ns += ns * n;
+    if (n && ns > h->max_ns) h->max_ns = ns;
+}
+
+void latency_merge(LatencyHistogram * into, const LatencyHistogram * h) {
+
+    for (int b = 0; b < LATENCY_BUCKETS; b ++) {
+        into->counts[b] += h->counts[b];
+    }
+
+    into->total += h->total;
+    into->sum_ns += h->sum_ns;
+    if (h->max_ns > into->max_ns) into->max_ns = h->max_ns;
+}
+
+// Duration below which a fraction p of the recorded durations lie (the upper end of its bucket)
+uint64_t latency_percentile(const LatencyHistogram * h, double p) {
+
+    if (h->total == 0) return 0;
+
+    uint64_t rank = (uint64_t) (p * h->total);
+    uint64_t seen = 0;
+
+    if (rank >= h->total) rank = h->total - 1;
+
+    for (int b = 0; b < LATENCY_BUCKETS; b ++) {
+
+        seen += h->counts[b];
+
+        if (seen > rank) {
+            uint64_t end = b + 1 < LATENCY_BUCKETS ? latency_bucket_start(b + 1) - 1 : UINT64_MAX;
+            return end < h->max_ns ? end : h->max_ns;
+        }
+    }
+
+    return h->max_ns;
+}
+
+// One line: count, mean and percentiles in microseconds
+void latency_print(const char * label, const LatencyHistogram * h) {
+
+    if (h->total == 0) {
+        printf("%-12s no samples\n", label);
+        return;
+    }
+
+    printf("%-12s %10llu  mean %9.2f  p50 %9.2f  p90 %9.2f  p99 %9.2f  p99.9 %9.2f  max %9.2f us\n", label,
+           (unsigned long long) h->total, h->sum_ns * 1E-3 / h->total, latency_percentile(h, 0.5) * 1E-3,
+           latency_percentile(h, 0.9) * 1E-3, latency_percentile(h, 0.99) * 1E-3, latency_percentile(h, 0.999) * 1E-3,
+           h->max_ns * 1E-3);
+}
+
+#endif
@@ -0,0 +1,629 @@
+#ifndef BATTLESHIP_MASKS
+#define BATTLESHIP_MASKS
+
+#include "battleship_bitboard.h"
+
+// GENERATED by src/TP2/ex9/gen_masks.c, do not edit by hand.
+//
+// PLACEMENT_MASKS[length][cell][direction] is the mask of a ship of `length` cells whose first cell is
+// `cell` (= i * 10 + j) and that extends towards DIRECTIONS[direction] ('N', 'E', 'S', 'W'). The mask
+// is empty when the ship would not fit on the board.
+
+#define MAX_SHIP_LENGTH 5
+
+const Bitboard PLACEMENT_MASKS[MAX_SHIP_LENGTH + 1][BB_CELLS][4] = {
+    { // length 0
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+    },
+    { // length 1
+        {{{0x0000000000000001ULL, 0x000000000ULL}}, {{0x0000000000000001ULL, 0x000000000ULL}}, {{0x0000000000000001ULL, 0x000000000ULL}}, {{0x0000000000000001ULL, 0x000000000ULL}}},
+        {{{0x0000000000000002ULL, 0x000000000ULL}}, {{0x0000000000000002ULL, 0x000000000ULL}}, {{0x0000000000000002ULL, 0x000000000ULL}}, {{0x0000000000000002ULL, 0x000000000ULL}}},
+        {{{0x0000000000000004ULL, 0x000000000ULL}}, {{0x0000000000000004ULL, 0x000000000ULL}}, {{0x0000000000000004ULL, 0x000000000ULL}}, {{0x0000000000000004ULL, 0x000000000ULL}}},
+        {{{0x0000000000000008ULL, 0x000000000ULL}}, {{0x0000000000000008ULL, 0x000000000ULL}}, {{0x0000000000000008ULL, 0x000000000ULL}}, {{0x0000000000000008ULL, 0x000000000ULL}}},
+        {{{0x0000000000000010ULL, 0x000000000ULL}}, {{0x0000000000000010ULL, 0x000000000ULL}}, {{0x0000000000000010ULL, 0x000000000ULL}}, {{0x0000000000000010ULL, 0x000000000ULL}}},
+        {{{0x0000000000000020ULL, 0x000000000ULL}}, {{0x0000000000000020ULL, 0x000000000ULL}}, {{0x0000000000000020ULL, 0x000000000ULL}}, {{0x0000000000000020ULL, 0x000000000ULL}}},
+        {{{0x0000000000000040ULL, 0x000000000ULL}}, {{0x0000000000000040ULL, 0x000000000ULL}}, {{0x0000000000000040ULL, 0x000000000ULL}}, {{0x0000000000000040ULL, 0x000000000ULL}}},
+        {{{0x0000000000000080ULL, 0x000000000ULL}}, {{0x0000000000000080ULL, 0x000000000ULL}}, {{0x0000000000000080ULL, 0x000000000ULL}}, {{0x0000000000000080ULL, 0x000000000ULL}}},
+        {{{0x0000000000000100ULL, 0x000000000ULL}}, {{0x0000000000000100ULL, 0x000000000ULL}}, {{0x0000000000000100ULL, 0x000000000ULL}}, {{0x0000000000000100ULL, 0x000000000ULL}}},
+        {{{0x0000000000000200ULL, 0x000000000ULL}}, {{0x0000000000000200ULL, 0x000000000ULL}}, {{0x0000000000000200ULL, 0x000000000ULL}}, {{0x0000000000000200ULL, 0x000000000ULL}}},
+        {{{0x0000000000000400ULL, 0x000000000ULL}}, {{0x0000000000000400ULL, 0x000000000ULL}}, {{0x0000000000000400ULL, 0x000000000ULL}}, {{0x0000000000000400ULL, 0x000000000ULL}}},
+        {{{0x0000000000000800ULL, 0x000000000ULL}}, {{0x0000000000000800ULL, 0x000000000ULL}}, {{0x0000000000000800ULL, 0x000000000ULL}}, {{0x0000000000000800ULL, 0x000000000ULL}}},
+        {{{0x0000000000001000ULL, 0x000000000ULL}}, {{0x0000000000001000ULL, 0x000000000ULL}}, {{0x0000000000001000ULL, 0x000000000ULL}}, {{0x0000000000001000ULL, 0x000000000ULL}}},
+        {{{0x0000000000002000ULL, 0x000000000ULL}}, {{0x0000000000002000ULL, 0x000000000ULL}}, {{0x0000000000002000ULL, 0x000000000ULL}}, {{0x0000000000002000ULL, 0x000000000ULL}}},
+        {{{0x0000000000004000ULL, 0x000000000ULL}}, {{0x0000000000004000ULL, 0x000000000ULL}}, {{0x0000000000004000ULL, 0x000000000ULL}}, {{0x0000000000004000ULL, 0x000000000ULL}}},
+        {{{0x0000000000008000ULL, 0x000000000ULL}}, {{0x0000000000008000ULL, 0x000000000ULL}}, {{0x0000000000008000ULL, 0x000000000ULL}}, {{0x0000000000008000ULL, 0x000000000ULL}}},
+        {{{0x0000000000010000ULL, 0x000000000ULL}}, {{0x0000000000010000ULL, 0x000000000ULL}}, {{0x0000000000010000ULL, 0x000000000ULL}}, {{0x0000000000010000ULL, 0x000000000ULL}}},
+        {{{0x0000000000020000ULL, 0x000000000ULL}}, {{0x0000000000020000ULL, 0x000000000ULL}}, {{0x0000000000020000ULL, 0x000000000ULL}}, {{0x0000000000020000ULL, 0x000000000ULL}}},
+        {{{0x0000000000040000ULL, 0x000000000ULL}}, {{0x0000000000040000ULL, 0x000000000ULL}}, {{0x0000000000040000ULL, 0x000000000ULL}}, {{0x0000000000040000ULL, 0x000000000ULL}}},
+        {{{0x0000000000080000ULL, 0x000000000ULL}}, {{0x0000000000080000ULL, 0x000000000ULL}}, {{0x0000000000080000ULL, 0x000000000ULL}}, {{0x0000000000080000ULL, 0x000000000ULL}}},
+        {{{0x0000000000100000ULL, 0x000000000ULL}}, {{0x0000000000100000ULL, 0x000000000ULL}}, {{0x0000000000100000ULL, 0x000000000ULL}}, {{0x0000000000100000ULL, 0x000000000ULL}}},
+        {{{0x0000000000200000ULL, 0x000000000ULL}}, {{0x0000000000200000ULL, 0x000000000ULL}}, {{0x0000000000200000ULL, 0x000000000ULL}}, {{0x0000000000200000ULL, 0x000000000ULL}}},
+        {{{0x0000000000400000ULL, 0x000000000ULL}}, {{0x0000000000400000ULL, 0x000000000ULL}}, {{0x0000000000400000ULL, 0x000000000ULL}}, {{0x0000000000400000ULL, 0x000000000ULL}}},
+        {{{0x0000000000800000ULL, 0x000000000ULL}}, {{0x0000000000800000ULL, 0x000000000ULL}}, {{0x0000000000800000ULL, 0x000000000ULL}}, {{0x0000000000800000ULL, 0x000000000ULL}}},
+        {{{0x0000000001000000ULL, 0x000000000ULL}}, {{0x0000000001000000ULL, 0x000000000ULL}}, {{0x0000000001000000ULL, 0x000000000ULL}}, {{0x0000000001000000ULL, 0x000000000ULL}}},
+        {{{0x0000000002000000ULL, 0x000000000ULL}}, {{0x0000000002000000ULL, 0x000000000ULL}}, {{0x0000000002000000ULL, 0x000000000ULL}}, {{0x0000000002000000ULL, 0x000000000ULL}}},
+        {{{0x0000000004000000ULL, 0x000000000ULL}}, {{0x0000000004000000ULL, 0x000000000ULL}}, {{0x0000000004000000ULL, 0x000000000ULL}}, {{0x0000000004000000ULL, 0x000000000ULL}}},
+        {{{0x0000000008000000ULL, 0x000000000ULL}}, {{0x0000000008000000ULL, 0x000000000ULL}}, {{0x0000000008000000ULL, 0x000000000ULL}}, {{0x0000000008000000ULL, 0x000000000ULL}}},
+        {{{0x0000000010000000ULL, 0x000000000ULL}}, {{0x0000000010000000ULL, 0x000000000ULL}}, {{0x0000000010000000ULL, 0x000000000ULL}}, {{0x0000000010000000ULL, 0x000000000ULL}}},
+        {{{0x0000000020000000ULL, 0x000000000ULL}}, {{0x0000000020000000ULL, 0x000000000ULL}}, {{0x0000000020000000ULL, 0x000000000ULL}}, {{0x0000000020000000ULL, 0x000000000ULL}}},
+        {{{0x0000000040000000ULL, 0x000000000ULL}}, {{0x0000000040000000ULL, 0x000000000ULL}}, {{0x0000000040000000ULL, 0x000000000ULL}}, {{0x0000000040000000ULL, 0x000000000ULL}}},
+        {{{0x0000000080000000ULL, 0x000000000ULL}}, {{0x0000000080000000ULL, 0x000000000ULL}}, {{0x0000000080000000ULL, 0x000000000ULL}}, {{0x0000000080000000ULL, 0x000000000ULL}}},
+        {{{0x0000000100000000ULL, 0x000000000ULL}}, {{0x0000000100000000ULL, 0x000000000ULL}}, {{0x0000000100000000ULL, 0x000000000ULL}}, {{0x0000000100000000ULL, 0x000000000ULL}}},
+        {{{0x0000000200000000ULL, 0x000000000ULL}}, {{0x0000000200000000ULL, 0x000000000ULL}}, {{0x0000000200000000ULL, 0x000000000ULL}}, {{0x0000000200000000ULL, 0x000000000ULL}}},
+        {{{0x0000000400000000ULL, 0x000000000ULL}}, {{0x0000000400000000ULL, 0x000000000ULL}}, {{0x0000000400000000ULL, 0x000000000ULL}}, {{0x0000000400000000ULL, 0x000000000ULL}}},
+        {{{0x0000000800000000ULL, 0x000000000ULL}}, {{0x0000000800000000ULL, 0x000000000ULL}}, {{0x0000000800000000ULL, 0x000000000ULL}}, {{0x0000000800000000ULL, 0x000000000ULL}}},
+        {{{0x0000001000000000ULL, 0x000000000ULL}}, {{0x0000001000000000ULL, 0x000000000ULL}}, {{0x0000001000000000ULL, 0x000000000ULL}}, {{0x0000001000000000ULL, 0x000000000ULL}}},
+        {{{0x0000002000000000ULL, 0x000000000ULL}}, {{0x0000002000000000ULL, 0x000000000ULL}}, {{0x0000002000000000ULL, 0x000000000ULL}}, {{0x0000002000000000ULL, 0x000000000ULL}}},
+        {{{0x0000004000000000ULL, 0x000000000ULL}}, {{0x0000004000000000ULL, 0x000000000ULL}}, {{0x0000004000000000ULL, 0x000000000ULL}}, {{0x0000004000000000ULL, 0x000000000ULL}}},
+        {{{0x0000008000000000ULL, 0x000000000ULL}}, {{0x0000008000000000ULL, 0x000000000ULL}}, {{0x0000008000000000ULL, 0x000000000ULL}}, {{0x0000008000000000ULL, 0x000000000ULL}}},
+        {{{0x0000010000000000ULL, 0x000000000ULL}}, {{0x0000010000000000ULL, 0x000000000ULL}}, {{0x0000010000000000ULL, 0x000000000ULL}}, {{0x0000010000000000ULL, 0x000000000ULL}}},
+        {{{0x0000020000000000ULL, 0x000000000ULL}}, {{0x0000020000000000ULL, 0x000000000ULL}}, {{0x0000020000000000ULL, 0x000000000ULL}}, {{0x0000020000000000ULL, 0x000000000ULL}}},
+        {{{0x0000040000000000ULL, 0x000000000ULL}}, {{0x0000040000000000ULL, 0x000000000ULL}}, {{0x0000040000000000ULL, 0x000000000ULL}}, {{0x0000040000000000ULL, 0x000000000ULL}}},
+        {{{0x0000080000000000ULL, 0x000000000ULL}}, {{0x0000080000000000ULL, 0x000000000ULL}}, {{0x0000080000000000ULL, 0x000000000ULL}}, {{0x0000080000000000ULL, 0x000000000ULL}}},
+        {{{0x0000100000000000ULL, 0x000000000ULL}}, {{0x0000100000000000ULL, 0x000000000ULL}}, {{0x0000100000000000ULL, 0x000000000ULL}}, {{0x0000100000000000ULL, 0x000000000ULL}}},
+        {{{0x0000200000000000ULL, 0x000000000ULL}}, {{0x0000200000000000ULL, 0x000000000ULL}}, {{0x0000200000000000ULL, 0x000000000ULL}}, {{0x0000200000000000ULL, 0x000000000ULL}}},
+        {{{0x0000400000000000ULL, 0x000000000ULL}}, {{0x0000400000000000ULL, 0x000000000ULL}}, {{0x0000400000000000ULL, 0x000000000ULL}}, {{0x0000400000000000ULL, 0x000000000ULL}}},
+        {{{0x0000800000000000ULL, 0x000000000ULL}}, {{0x0000800000000000ULL, 0x000000000ULL}}, {{0x0000800000000000ULL, 0x000000000ULL}}, {{0x0000800000000000ULL, 0x000000000ULL}}},
+        {{{0x0001000000000000ULL, 0x000000000ULL}}, {{0x0001000000000000ULL, 0x000000000ULL}}, {{0x0001000000000000ULL, 0x000000000ULL}}, {{0x0001000000000000ULL, 0x000000000ULL}}},
+        {{{0x0002000000000000ULL, 0x000000000ULL}}, {{0x0002000000000000ULL, 0x000000000ULL}}, {{0x0002000000000000ULL, 0x000000000ULL}}, {{0x0002000000000000ULL, 0x000000000ULL}}},
+        {{{0x0004000000000000ULL, 0x000000000ULL}}, {{0x0004000000000000ULL, 0x000000000ULL}}, {{0x0004000000000000ULL, 0x000000000ULL}}, {{0x0004000000000000ULL, 0x000000000ULL}}},
+        {{{0x0008000000000000ULL, 0x000000000ULL}}, {{0x0008000000000000ULL, 0x000000000ULL}}, {{0x0008000000000000ULL, 0x000000000ULL}}, {{0x0008000000000000ULL, 0x000000000ULL}}},
+        {{{0x0010000000000000ULL, 0x000000000ULL}}, {{0x0010000000000000ULL, 0x000000000ULL}}, {{0x0010000000000000ULL, 0x000000000ULL}}, {{0x0010000000000000ULL, 0x000000000ULL}}},
+        {{{0x0020000000000000ULL, 0x000000000ULL}}, {{0x0020000000000000ULL, 0x000000000ULL}}, {{0x0020000000000000ULL, 0x000000000ULL}}, {{0x0020000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x000000000ULL}}},
+        {{{0x0080000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x000000000ULL}}},
+        {{{0x0100000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x000000000ULL}}},
+        {{{0x0200000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x000000000ULL}}},
+        {{{0x0400000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x000000000ULL}}},
+        {{{0x0800000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x000000000ULL}}},
+        {{{0x1000000000000000ULL, 0x000000000ULL}}, {{0x1000000000000000ULL, 0x000000000ULL}}, {{0x1000000000000000ULL, 0x000000000ULL}}, {{0x1000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2000000000000000ULL, 0x000000000ULL}}, {{0x2000000000000000ULL, 0x000000000ULL}}, {{0x2000000000000000ULL, 0x000000000ULL}}, {{0x2000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4000000000000000ULL, 0x000000000ULL}}, {{0x4000000000000000ULL, 0x000000000ULL}}, {{0x4000000000000000ULL, 0x000000000ULL}}, {{0x4000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8000000000000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x000000001ULL}}},
+        {{{0x0000000000000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x000000002ULL}}},
+        {{{0x0000000000000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x000000004ULL}}},
+        {{{0x0000000000000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000008ULL}}},
+        {{{0x0000000000000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000010ULL}}},
+        {{{0x0000000000000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000020ULL}}},
+        {{{0x0000000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000040ULL}}},
+        {{{0x0000000000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000080ULL}}},
+        {{{0x0000000000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000100ULL}}},
+        {{{0x0000000000000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000000200ULL}}},
+        {{{0x0000000000000000ULL, 0x000000400ULL}}, {{0x0000000000000000ULL, 0x000000400ULL}}, {{0x0000000000000000ULL, 0x000000400ULL}}, {{0x0000000000000000ULL, 0x000000400ULL}}},
+        {{{0x0000000000000000ULL, 0x000000800ULL}}, {{0x0000000000000000ULL, 0x000000800ULL}}, {{0x0000000000000000ULL, 0x000000800ULL}}, {{0x0000000000000000ULL, 0x000000800ULL}}},
+        {{{0x0000000000000000ULL, 0x000001000ULL}}, {{0x0000000000000000ULL, 0x000001000ULL}}, {{0x0000000000000000ULL, 0x000001000ULL}}, {{0x0000000000000000ULL, 0x000001000ULL}}},
+        {{{0x0000000000000000ULL, 0x000002000ULL}}, {{0x0000000000000000ULL, 0x000002000ULL}}, {{0x0000000000000000ULL, 0x000002000ULL}}, {{0x0000000000000000ULL, 0x000002000ULL}}},
+        {{{0x0000000000000000ULL, 0x000004000ULL}}, {{0x0000000000000000ULL, 0x000004000ULL}}, {{0x0000000000000000ULL, 0x000004000ULL}}, {{0x0000000000000000ULL, 0x000004000ULL}}},
+        {{{0x0000000000000000ULL, 0x000008000ULL}}, {{0x0000000000000000ULL, 0x000008000ULL}}, {{0x0000000000000000ULL, 0x000008000ULL}}, {{0x0000000000000000ULL, 0x000008000ULL}}},
+        {{{0x0000000000000000ULL, 0x000010000ULL}}, {{0x0000000000000000ULL, 0x000010000ULL}}, {{0x0000000000000000ULL, 0x000010000ULL}}, {{0x0000000000000000ULL, 0x000010000ULL}}},
+        {{{0x0000000000000000ULL, 0x000020000ULL}}, {{0x0000000000000000ULL, 0x000020000ULL}}, {{0x0000000000000000ULL, 0x000020000ULL}}, {{0x0000000000000000ULL, 0x000020000ULL}}},
+        {{{0x0000000000000000ULL, 0x000040000ULL}}, {{0x0000000000000000ULL, 0x000040000ULL}}, {{0x0000000000000000ULL, 0x000040000ULL}}, {{0x0000000000000000ULL, 0x000040000ULL}}},
+        {{{0x0000000000000000ULL, 0x000080000ULL}}, {{0x0000000000000000ULL, 0x000080000ULL}}, {{0x0000000000000000ULL, 0x000080000ULL}}, {{0x0000000000000000ULL, 0x000080000ULL}}},
+        {{{0x0000000000000000ULL, 0x000100000ULL}}, {{0x0000000000000000ULL, 0x000100000ULL}}, {{0x0000000000000000ULL, 0x000100000ULL}}, {{0x0000000000000000ULL, 0x000100000ULL}}},
+        {{{0x0000000000000000ULL, 0x000200000ULL}}, {{0x0000000000000000ULL, 0x000200000ULL}}, {{0x0000000000000000ULL, 0x000200000ULL}}, {{0x0000000000000000ULL, 0x000200000ULL}}},
+        {{{0x0000000000000000ULL, 0x000400000ULL}}, {{0x0000000000000000ULL, 0x000400000ULL}}, {{0x0000000000000000ULL, 0x000400000ULL}}, {{0x0000000000000000ULL, 0x000400000ULL}}},
+        {{{0x0000000000000000ULL, 0x000800000ULL}}, {{0x0000000000000000ULL, 0x000800000ULL}}, {{0x0000000000000000ULL, 0x000800000ULL}}, {{0x0000000000000000ULL, 0x000800000ULL}}},
+        {{{0x0000000000000000ULL, 0x001000000ULL}}, {{0x0000000000000000ULL, 0x001000000ULL}}, {{0x0000000000000000ULL, 0x001000000ULL}}, {{0x0000000000000000ULL, 0x001000000ULL}}},
+        {{{0x0000000000000000ULL, 0x002000000ULL}}, {{0x0000000000000000ULL, 0x002000000ULL}}, {{0x0000000000000000ULL, 0x002000000ULL}}, {{0x0000000000000000ULL, 0x002000000ULL}}},
+        {{{0x0000000000000000ULL, 0x004000000ULL}}, {{0x0000000000000000ULL, 0x004000000ULL}}, {{0x0000000000000000ULL, 0x004000000ULL}}, {{0x0000000000000000ULL, 0x004000000ULL}}},
+        {{{0x0000000000000000ULL, 0x008000000ULL}}, {{0x0000000000000000ULL, 0x008000000ULL}}, {{0x0000000000000000ULL, 0x008000000ULL}}, {{0x0000000000000000ULL, 0x008000000ULL}}},
+        {{{0x0000000000000000ULL, 0x010000000ULL}}, {{0x0000000000000000ULL, 0x010000000ULL}}, {{0x0000000000000000ULL, 0x010000000ULL}}, {{0x0000000000000000ULL, 0x010000000ULL}}},
+        {{{0x0000000000000000ULL, 0x020000000ULL}}, {{0x0000000000000000ULL, 0x020000000ULL}}, {{0x0000000000000000ULL, 0x020000000ULL}}, {{0x0000000000000000ULL, 0x020000000ULL}}},
+        {{{0x0000000000000000ULL, 0x040000000ULL}}, {{0x0000000000000000ULL, 0x040000000ULL}}, {{0x0000000000000000ULL, 0x040000000ULL}}, {{0x0000000000000000ULL, 0x040000000ULL}}},
+        {{{0x0000000000000000ULL, 0x080000000ULL}}, {{0x0000000000000000ULL, 0x080000000ULL}}, {{0x0000000000000000ULL, 0x080000000ULL}}, {{0x0000000000000000ULL, 0x080000000ULL}}},
+        {{{0x0000000000000000ULL, 0x100000000ULL}}, {{0x0000000000000000ULL, 0x100000000ULL}}, {{0x0000000000000000ULL, 0x100000000ULL}}, {{0x0000000000000000ULL, 0x100000000ULL}}},
+        {{{0x0000000000000000ULL, 0x200000000ULL}}, {{0x0000000000000000ULL, 0x200000000ULL}}, {{0x0000000000000000ULL, 0x200000000ULL}}, {{0x0000000000000000ULL, 0x200000000ULL}}},
+        {{{0x0000000000000000ULL, 0x400000000ULL}}, {{0x0000000000000000ULL, 0x400000000ULL}}, {{0x0000000000000000ULL, 0x400000000ULL}}, {{0x0000000000000000ULL, 0x400000000ULL}}},
+        {{{0x0000000000000000ULL, 0x800000000ULL}}, {{0x0000000000000000ULL, 0x800000000ULL}}, {{0x0000000000000000ULL, 0x800000000ULL}}, {{0x0000000000000000ULL, 0x800000000ULL}}},
+    },
+    { // length 2
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000003ULL, 0x000000000ULL}}, {{0x0000000000000401ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000006ULL, 0x000000000ULL}}, {{0x0000000000000802ULL, 0x000000000ULL}}, {{0x0000000000000003ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000000cULL, 0x000000000ULL}}, {{0x0000000000001004ULL, 0x000000000ULL}}, {{0x0000000000000006ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000018ULL, 0x000000000ULL}}, {{0x0000000000002008ULL, 0x000000000ULL}}, {{0x000000000000000cULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000030ULL, 0x000000000ULL}}, {{0x0000000000004010ULL, 0x000000000ULL}}, {{0x0000000000000018ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000060ULL, 0x000000000ULL}}, {{0x0000000000008020ULL, 0x000000000ULL}}, {{0x0000000000000030ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000000c0ULL, 0x000000000ULL}}, {{0x0000000000010040ULL, 0x000000000ULL}}, {{0x0000000000000060ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000180ULL, 0x000000000ULL}}, {{0x0000000000020080ULL, 0x000000000ULL}}, {{0x00000000000000c0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000300ULL, 0x000000000ULL}}, {{0x0000000000040100ULL, 0x000000000ULL}}, {{0x0000000000000180ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000080200ULL, 0x000000000ULL}}, {{0x0000000000000300ULL, 0x000000000ULL}}},
+        {{{0x0000000000000401ULL, 0x000000000ULL}}, {{0x0000000000000c00ULL, 0x000000000ULL}}, {{0x0000000000100400ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000802ULL, 0x000000000ULL}}, {{0x0000000000001800ULL, 0x000000000ULL}}, {{0x0000000000200800ULL, 0x000000000ULL}}, {{0x0000000000000c00ULL, 0x000000000ULL}}},
+        {{{0x0000000000001004ULL, 0x000000000ULL}}, {{0x0000000000003000ULL, 0x000000000ULL}}, {{0x0000000000401000ULL, 0x000000000ULL}}, {{0x0000000000001800ULL, 0x000000000ULL}}},
+        {{{0x0000000000002008ULL, 0x000000000ULL}}, {{0x0000000000006000ULL, 0x000000000ULL}}, {{0x0000000000802000ULL, 0x000000000ULL}}, {{0x0000000000003000ULL, 0x000000000ULL}}},
+        {{{0x0000000000004010ULL, 0x000000000ULL}}, {{0x000000000000c000ULL, 0x000000000ULL}}, {{0x0000000001004000ULL, 0x000000000ULL}}, {{0x0000000000006000ULL, 0x000000000ULL}}},
+        {{{0x0000000000008020ULL, 0x000000000ULL}}, {{0x0000000000018000ULL, 0x000000000ULL}}, {{0x0000000002008000ULL, 0x000000000ULL}}, {{0x000000000000c000ULL, 0x000000000ULL}}},
+        {{{0x0000000000010040ULL, 0x000000000ULL}}, {{0x0000000000030000ULL, 0x000000000ULL}}, {{0x0000000004010000ULL, 0x000000000ULL}}, {{0x0000000000018000ULL, 0x000000000ULL}}},
+        {{{0x0000000000020080ULL, 0x000000000ULL}}, {{0x0000000000060000ULL, 0x000000000ULL}}, {{0x0000000008020000ULL, 0x000000000ULL}}, {{0x0000000000030000ULL, 0x000000000ULL}}},
+        {{{0x0000000000040100ULL, 0x000000000ULL}}, {{0x00000000000c0000ULL, 0x000000000ULL}}, {{0x0000000010040000ULL, 0x000000000ULL}}, {{0x0000000000060000ULL, 0x000000000ULL}}},
+        {{{0x0000000000080200ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000020080000ULL, 0x000000000ULL}}, {{0x00000000000c0000ULL, 0x000000000ULL}}},
+        {{{0x0000000000100400ULL, 0x000000000ULL}}, {{0x0000000000300000ULL, 0x000000000ULL}}, {{0x0000000040100000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000200800ULL, 0x000000000ULL}}, {{0x0000000000600000ULL, 0x000000000ULL}}, {{0x0000000080200000ULL, 0x000000000ULL}}, {{0x0000000000300000ULL, 0x000000000ULL}}},
+        {{{0x0000000000401000ULL, 0x000000000ULL}}, {{0x0000000000c00000ULL, 0x000000000ULL}}, {{0x0000000100400000ULL, 0x000000000ULL}}, {{0x0000000000600000ULL, 0x000000000ULL}}},
+        {{{0x0000000000802000ULL, 0x000000000ULL}}, {{0x0000000001800000ULL, 0x000000000ULL}}, {{0x0000000200800000ULL, 0x000000000ULL}}, {{0x0000000000c00000ULL, 0x000000000ULL}}},
+        {{{0x0000000001004000ULL, 0x000000000ULL}}, {{0x0000000003000000ULL, 0x000000000ULL}}, {{0x0000000401000000ULL, 0x000000000ULL}}, {{0x0000000001800000ULL, 0x000000000ULL}}},
+        {{{0x0000000002008000ULL, 0x000000000ULL}}, {{0x0000000006000000ULL, 0x000000000ULL}}, {{0x0000000802000000ULL, 0x000000000ULL}}, {{0x0000000003000000ULL, 0x000000000ULL}}},
+        {{{0x0000000004010000ULL, 0x000000000ULL}}, {{0x000000000c000000ULL, 0x000000000ULL}}, {{0x0000001004000000ULL, 0x000000000ULL}}, {{0x0000000006000000ULL, 0x000000000ULL}}},
+        {{{0x0000000008020000ULL, 0x000000000ULL}}, {{0x0000000018000000ULL, 0x000000000ULL}}, {{0x0000002008000000ULL, 0x000000000ULL}}, {{0x000000000c000000ULL, 0x000000000ULL}}},
+        {{{0x0000000010040000ULL, 0x000000000ULL}}, {{0x0000000030000000ULL, 0x000000000ULL}}, {{0x0000004010000000ULL, 0x000000000ULL}}, {{0x0000000018000000ULL, 0x000000000ULL}}},
+        {{{0x0000000020080000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000008020000000ULL, 0x000000000ULL}}, {{0x0000000030000000ULL, 0x000000000ULL}}},
+        {{{0x0000000040100000ULL, 0x000000000ULL}}, {{0x00000000c0000000ULL, 0x000000000ULL}}, {{0x0000010040000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000080200000ULL, 0x000000000ULL}}, {{0x0000000180000000ULL, 0x000000000ULL}}, {{0x0000020080000000ULL, 0x000000000ULL}}, {{0x00000000c0000000ULL, 0x000000000ULL}}},
+        {{{0x0000000100400000ULL, 0x000000000ULL}}, {{0x0000000300000000ULL, 0x000000000ULL}}, {{0x0000040100000000ULL, 0x000000000ULL}}, {{0x0000000180000000ULL, 0x000000000ULL}}},
+        {{{0x0000000200800000ULL, 0x000000000ULL}}, {{0x0000000600000000ULL, 0x000000000ULL}}, {{0x0000080200000000ULL, 0x000000000ULL}}, {{0x0000000300000000ULL, 0x000000000ULL}}},
+        {{{0x0000000401000000ULL, 0x000000000ULL}}, {{0x0000000c00000000ULL, 0x000000000ULL}}, {{0x0000100400000000ULL, 0x000000000ULL}}, {{0x0000000600000000ULL, 0x000000000ULL}}},
+        {{{0x0000000802000000ULL, 0x000000000ULL}}, {{0x0000001800000000ULL, 0x000000000ULL}}, {{0x0000200800000000ULL, 0x000000000ULL}}, {{0x0000000c00000000ULL, 0x000000000ULL}}},
+        {{{0x0000001004000000ULL, 0x000000000ULL}}, {{0x0000003000000000ULL, 0x000000000ULL}}, {{0x0000401000000000ULL, 0x000000000ULL}}, {{0x0000001800000000ULL, 0x000000000ULL}}},
+        {{{0x0000002008000000ULL, 0x000000000ULL}}, {{0x0000006000000000ULL, 0x000000000ULL}}, {{0x0000802000000000ULL, 0x000000000ULL}}, {{0x0000003000000000ULL, 0x000000000ULL}}},
+        {{{0x0000004010000000ULL, 0x000000000ULL}}, {{0x000000c000000000ULL, 0x000000000ULL}}, {{0x0001004000000000ULL, 0x000000000ULL}}, {{0x0000006000000000ULL, 0x000000000ULL}}},
+        {{{0x0000008020000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0002008000000000ULL, 0x000000000ULL}}, {{0x000000c000000000ULL, 0x000000000ULL}}},
+        {{{0x0000010040000000ULL, 0x000000000ULL}}, {{0x0000030000000000ULL, 0x000000000ULL}}, {{0x0004010000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000020080000000ULL, 0x000000000ULL}}, {{0x0000060000000000ULL, 0x000000000ULL}}, {{0x0008020000000000ULL, 0x000000000ULL}}, {{0x0000030000000000ULL, 0x000000000ULL}}},
+        {{{0x0000040100000000ULL, 0x000000000ULL}}, {{0x00000c0000000000ULL, 0x000000000ULL}}, {{0x0010040000000000ULL, 0x000000000ULL}}, {{0x0000060000000000ULL, 0x000000000ULL}}},
+        {{{0x0000080200000000ULL, 0x000000000ULL}}, {{0x0000180000000000ULL, 0x000000000ULL}}, {{0x0020080000000000ULL, 0x000000000ULL}}, {{0x00000c0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000100400000000ULL, 0x000000000ULL}}, {{0x0000300000000000ULL, 0x000000000ULL}}, {{0x0040100000000000ULL, 0x000000000ULL}}, {{0x0000180000000000ULL, 0x000000000ULL}}},
+        {{{0x0000200800000000ULL, 0x000000000ULL}}, {{0x0000600000000000ULL, 0x000000000ULL}}, {{0x0080200000000000ULL, 0x000000000ULL}}, {{0x0000300000000000ULL, 0x000000000ULL}}},
+        {{{0x0000401000000000ULL, 0x000000000ULL}}, {{0x0000c00000000000ULL, 0x000000000ULL}}, {{0x0100400000000000ULL, 0x000000000ULL}}, {{0x0000600000000000ULL, 0x000000000ULL}}},
+        {{{0x0000802000000000ULL, 0x000000000ULL}}, {{0x0001800000000000ULL, 0x000000000ULL}}, {{0x0200800000000000ULL, 0x000000000ULL}}, {{0x0000c00000000000ULL, 0x000000000ULL}}},
+        {{{0x0001004000000000ULL, 0x000000000ULL}}, {{0x0003000000000000ULL, 0x000000000ULL}}, {{0x0401000000000000ULL, 0x000000000ULL}}, {{0x0001800000000000ULL, 0x000000000ULL}}},
+        {{{0x0002008000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802000000000000ULL, 0x000000000ULL}}, {{0x0003000000000000ULL, 0x000000000ULL}}},
+        {{{0x0004010000000000ULL, 0x000000000ULL}}, {{0x000c000000000000ULL, 0x000000000ULL}}, {{0x1004000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0008020000000000ULL, 0x000000000ULL}}, {{0x0018000000000000ULL, 0x000000000ULL}}, {{0x2008000000000000ULL, 0x000000000ULL}}, {{0x000c000000000000ULL, 0x000000000ULL}}},
+        {{{0x0010040000000000ULL, 0x000000000ULL}}, {{0x0030000000000000ULL, 0x000000000ULL}}, {{0x4010000000000000ULL, 0x000000000ULL}}, {{0x0018000000000000ULL, 0x000000000ULL}}},
+        {{{0x0020080000000000ULL, 0x000000000ULL}}, {{0x0060000000000000ULL, 0x000000000ULL}}, {{0x8020000000000000ULL, 0x000000000ULL}}, {{0x0030000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100000000000ULL, 0x000000000ULL}}, {{0x00c0000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x000000001ULL}}, {{0x0060000000000000ULL, 0x000000000ULL}}},
+        {{{0x0080200000000000ULL, 0x000000000ULL}}, {{0x0180000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x000000002ULL}}, {{0x00c0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0100400000000000ULL, 0x000000000ULL}}, {{0x0300000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x000000004ULL}}, {{0x0180000000000000ULL, 0x000000000ULL}}},
+        {{{0x0200800000000000ULL, 0x000000000ULL}}, {{0x0600000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x000000008ULL}}, {{0x0300000000000000ULL, 0x000000000ULL}}},
+        {{{0x0401000000000000ULL, 0x000000000ULL}}, {{0x0c00000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x000000010ULL}}, {{0x0600000000000000ULL, 0x000000000ULL}}},
+        {{{0x0802000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x000000020ULL}}, {{0x0c00000000000000ULL, 0x000000000ULL}}},
+        {{{0x1004000000000000ULL, 0x000000000ULL}}, {{0x3000000000000000ULL, 0x000000000ULL}}, {{0x1000000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008000000000000ULL, 0x000000000ULL}}, {{0x6000000000000000ULL, 0x000000000ULL}}, {{0x2000000000000000ULL, 0x000000080ULL}}, {{0x3000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010000000000000ULL, 0x000000000ULL}}, {{0xc000000000000000ULL, 0x000000000ULL}}, {{0x4000000000000000ULL, 0x000000100ULL}}, {{0x6000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020000000000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x000000001ULL}}, {{0x8000000000000000ULL, 0x000000200ULL}}, {{0xc000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040000000000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x000000003ULL}}, {{0x0000000000000000ULL, 0x000000401ULL}}, {{0x8000000000000000ULL, 0x000000001ULL}}},
+        {{{0x0080000000000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x000000006ULL}}, {{0x0000000000000000ULL, 0x000000802ULL}}, {{0x0000000000000000ULL, 0x000000003ULL}}},
+        {{{0x0100000000000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x00000000cULL}}, {{0x0000000000000000ULL, 0x000001004ULL}}, {{0x0000000000000000ULL, 0x000000006ULL}}},
+        {{{0x0200000000000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000018ULL}}, {{0x0000000000000000ULL, 0x000002008ULL}}, {{0x0000000000000000ULL, 0x00000000cULL}}},
+        {{{0x0400000000000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000030ULL}}, {{0x0000000000000000ULL, 0x000004010ULL}}, {{0x0000000000000000ULL, 0x000000018ULL}}},
+        {{{0x0800000000000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000008020ULL}}, {{0x0000000000000000ULL, 0x000000030ULL}}},
+        {{{0x1000000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x0000000c0ULL}}, {{0x0000000000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2000000000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000180ULL}}, {{0x0000000000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x0000000c0ULL}}},
+        {{{0x4000000000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000300ULL}}, {{0x0000000000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x000000180ULL}}},
+        {{{0x8000000000000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000000600ULL}}, {{0x0000000000000000ULL, 0x000080200ULL}}, {{0x0000000000000000ULL, 0x000000300ULL}}},
+        {{{0x0000000000000000ULL, 0x000000401ULL}}, {{0x0000000000000000ULL, 0x000000c00ULL}}, {{0x0000000000000000ULL, 0x000100400ULL}}, {{0x0000000000000000ULL, 0x000000600ULL}}},
+        {{{0x0000000000000000ULL, 0x000000802ULL}}, {{0x0000000000000000ULL, 0x000001800ULL}}, {{0x0000000000000000ULL, 0x000200800ULL}}, {{0x0000000000000000ULL, 0x000000c00ULL}}},
+        {{{0x0000000000000000ULL, 0x000001004ULL}}, {{0x0000000000000000ULL, 0x000003000ULL}}, {{0x0000000000000000ULL, 0x000401000ULL}}, {{0x0000000000000000ULL, 0x000001800ULL}}},
+        {{{0x0000000000000000ULL, 0x000002008ULL}}, {{0x0000000000000000ULL, 0x000006000ULL}}, {{0x0000000000000000ULL, 0x000802000ULL}}, {{0x0000000000000000ULL, 0x000003000ULL}}},
+        {{{0x0000000000000000ULL, 0x000004010ULL}}, {{0x0000000000000000ULL, 0x00000c000ULL}}, {{0x0000000000000000ULL, 0x001004000ULL}}, {{0x0000000000000000ULL, 0x000006000ULL}}},
+        {{{0x0000000000000000ULL, 0x000008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x002008000ULL}}, {{0x0000000000000000ULL, 0x00000c000ULL}}},
+        {{{0x0000000000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x000030000ULL}}, {{0x0000000000000000ULL, 0x004010000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x000060000ULL}}, {{0x0000000000000000ULL, 0x008020000ULL}}, {{0x0000000000000000ULL, 0x000030000ULL}}},
+        {{{0x0000000000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x0000c0000ULL}}, {{0x0000000000000000ULL, 0x010040000ULL}}, {{0x0000000000000000ULL, 0x000060000ULL}}},
+        {{{0x0000000000000000ULL, 0x000080200ULL}}, {{0x0000000000000000ULL, 0x000180000ULL}}, {{0x0000000000000000ULL, 0x020080000ULL}}, {{0x0000000000000000ULL, 0x0000c0000ULL}}},
+        {{{0x0000000000000000ULL, 0x000100400ULL}}, {{0x0000000000000000ULL, 0x000300000ULL}}, {{0x0000000000000000ULL, 0x040100000ULL}}, {{0x0000000000000000ULL, 0x000180000ULL}}},
+        {{{0x0000000000000000ULL, 0x000200800ULL}}, {{0x0000000000000000ULL, 0x000600000ULL}}, {{0x0000000000000000ULL, 0x080200000ULL}}, {{0x0000000000000000ULL, 0x000300000ULL}}},
+        {{{0x0000000000000000ULL, 0x000401000ULL}}, {{0x0000000000000000ULL, 0x000c00000ULL}}, {{0x0000000000000000ULL, 0x100400000ULL}}, {{0x0000000000000000ULL, 0x000600000ULL}}},
+        {{{0x0000000000000000ULL, 0x000802000ULL}}, {{0x0000000000000000ULL, 0x001800000ULL}}, {{0x0000000000000000ULL, 0x200800000ULL}}, {{0x0000000000000000ULL, 0x000c00000ULL}}},
+        {{{0x0000000000000000ULL, 0x001004000ULL}}, {{0x0000000000000000ULL, 0x003000000ULL}}, {{0x0000000000000000ULL, 0x401000000ULL}}, {{0x0000000000000000ULL, 0x001800000ULL}}},
+        {{{0x0000000000000000ULL, 0x002008000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x802000000ULL}}, {{0x0000000000000000ULL, 0x003000000ULL}}},
+        {{{0x0000000000000000ULL, 0x004010000ULL}}, {{0x0000000000000000ULL, 0x00c000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x008020000ULL}}, {{0x0000000000000000ULL, 0x018000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x00c000000ULL}}},
+        {{{0x0000000000000000ULL, 0x010040000ULL}}, {{0x0000000000000000ULL, 0x030000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x018000000ULL}}},
+        {{{0x0000000000000000ULL, 0x020080000ULL}}, {{0x0000000000000000ULL, 0x060000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x030000000ULL}}},
+        {{{0x0000000000000000ULL, 0x040100000ULL}}, {{0x0000000000000000ULL, 0x0c0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x060000000ULL}}},
+        {{{0x0000000000000000ULL, 0x080200000ULL}}, {{0x0000000000000000ULL, 0x180000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0c0000000ULL}}},
+        {{{0x0000000000000000ULL, 0x100400000ULL}}, {{0x0000000000000000ULL, 0x300000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x180000000ULL}}},
+        {{{0x0000000000000000ULL, 0x200800000ULL}}, {{0x0000000000000000ULL, 0x600000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x300000000ULL}}},
+        {{{0x0000000000000000ULL, 0x401000000ULL}}, {{0x0000000000000000ULL, 0xc00000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x600000000ULL}}},
+        {{{0x0000000000000000ULL, 0x802000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0xc00000000ULL}}},
+    },
+    { // length 3
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000007ULL, 0x000000000ULL}}, {{0x0000000000100401ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000000eULL, 0x000000000ULL}}, {{0x0000000000200802ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000001cULL, 0x000000000ULL}}, {{0x0000000000401004ULL, 0x000000000ULL}}, {{0x0000000000000007ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000038ULL, 0x000000000ULL}}, {{0x0000000000802008ULL, 0x000000000ULL}}, {{0x000000000000000eULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000070ULL, 0x000000000ULL}}, {{0x0000000001004010ULL, 0x000000000ULL}}, {{0x000000000000001cULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000000e0ULL, 0x000000000ULL}}, {{0x0000000002008020ULL, 0x000000000ULL}}, {{0x0000000000000038ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000001c0ULL, 0x000000000ULL}}, {{0x0000000004010040ULL, 0x000000000ULL}}, {{0x0000000000000070ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000380ULL, 0x000000000ULL}}, {{0x0000000008020080ULL, 0x000000000ULL}}, {{0x00000000000000e0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000010040100ULL, 0x000000000ULL}}, {{0x00000000000001c0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000020080200ULL, 0x000000000ULL}}, {{0x0000000000000380ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000001c00ULL, 0x000000000ULL}}, {{0x0000000040100400ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000003800ULL, 0x000000000ULL}}, {{0x0000000080200800ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000007000ULL, 0x000000000ULL}}, {{0x0000000100401000ULL, 0x000000000ULL}}, {{0x0000000000001c00ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000e000ULL, 0x000000000ULL}}, {{0x0000000200802000ULL, 0x000000000ULL}}, {{0x0000000000003800ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000001c000ULL, 0x000000000ULL}}, {{0x0000000401004000ULL, 0x000000000ULL}}, {{0x0000000000007000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000038000ULL, 0x000000000ULL}}, {{0x0000000802008000ULL, 0x000000000ULL}}, {{0x000000000000e000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000070000ULL, 0x000000000ULL}}, {{0x0000001004010000ULL, 0x000000000ULL}}, {{0x000000000001c000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000e0000ULL, 0x000000000ULL}}, {{0x0000002008020000ULL, 0x000000000ULL}}, {{0x0000000000038000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000004010040000ULL, 0x000000000ULL}}, {{0x0000000000070000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000008020080000ULL, 0x000000000ULL}}, {{0x00000000000e0000ULL, 0x000000000ULL}}},
+        {{{0x0000000000100401ULL, 0x000000000ULL}}, {{0x0000000000700000ULL, 0x000000000ULL}}, {{0x0000010040100000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000200802ULL, 0x000000000ULL}}, {{0x0000000000e00000ULL, 0x000000000ULL}}, {{0x0000020080200000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000401004ULL, 0x000000000ULL}}, {{0x0000000001c00000ULL, 0x000000000ULL}}, {{0x0000040100400000ULL, 0x000000000ULL}}, {{0x0000000000700000ULL, 0x000000000ULL}}},
+        {{{0x0000000000802008ULL, 0x000000000ULL}}, {{0x0000000003800000ULL, 0x000000000ULL}}, {{0x0000080200800000ULL, 0x000000000ULL}}, {{0x0000000000e00000ULL, 0x000000000ULL}}},
+        {{{0x0000000001004010ULL, 0x000000000ULL}}, {{0x0000000007000000ULL, 0x000000000ULL}}, {{0x0000100401000000ULL, 0x000000000ULL}}, {{0x0000000001c00000ULL, 0x000000000ULL}}},
+        {{{0x0000000002008020ULL, 0x000000000ULL}}, {{0x000000000e000000ULL, 0x000000000ULL}}, {{0x0000200802000000ULL, 0x000000000ULL}}, {{0x0000000003800000ULL, 0x000000000ULL}}},
+        {{{0x0000000004010040ULL, 0x000000000ULL}}, {{0x000000001c000000ULL, 0x000000000ULL}}, {{0x0000401004000000ULL, 0x000000000ULL}}, {{0x0000000007000000ULL, 0x000000000ULL}}},
+        {{{0x0000000008020080ULL, 0x000000000ULL}}, {{0x0000000038000000ULL, 0x000000000ULL}}, {{0x0000802008000000ULL, 0x000000000ULL}}, {{0x000000000e000000ULL, 0x000000000ULL}}},
+        {{{0x0000000010040100ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0001004010000000ULL, 0x000000000ULL}}, {{0x000000001c000000ULL, 0x000000000ULL}}},
+        {{{0x0000000020080200ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0002008020000000ULL, 0x000000000ULL}}, {{0x0000000038000000ULL, 0x000000000ULL}}},
+        {{{0x0000000040100400ULL, 0x000000000ULL}}, {{0x00000001c0000000ULL, 0x000000000ULL}}, {{0x0004010040000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000080200800ULL, 0x000000000ULL}}, {{0x0000000380000000ULL, 0x000000000ULL}}, {{0x0008020080000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000100401000ULL, 0x000000000ULL}}, {{0x0000000700000000ULL, 0x000000000ULL}}, {{0x0010040100000000ULL, 0x000000000ULL}}, {{0x00000001c0000000ULL, 0x000000000ULL}}},
+        {{{0x0000000200802000ULL, 0x000000000ULL}}, {{0x0000000e00000000ULL, 0x000000000ULL}}, {{0x0020080200000000ULL, 0x000000000ULL}}, {{0x0000000380000000ULL, 0x000000000ULL}}},
+        {{{0x0000000401004000ULL, 0x000000000ULL}}, {{0x0000001c00000000ULL, 0x000000000ULL}}, {{0x0040100400000000ULL, 0x000000000ULL}}, {{0x0000000700000000ULL, 0x000000000ULL}}},
+        {{{0x0000000802008000ULL, 0x000000000ULL}}, {{0x0000003800000000ULL, 0x000000000ULL}}, {{0x0080200800000000ULL, 0x000000000ULL}}, {{0x0000000e00000000ULL, 0x000000000ULL}}},
+        {{{0x0000001004010000ULL, 0x000000000ULL}}, {{0x0000007000000000ULL, 0x000000000ULL}}, {{0x0100401000000000ULL, 0x000000000ULL}}, {{0x0000001c00000000ULL, 0x000000000ULL}}},
+        {{{0x0000002008020000ULL, 0x000000000ULL}}, {{0x000000e000000000ULL, 0x000000000ULL}}, {{0x0200802000000000ULL, 0x000000000ULL}}, {{0x0000003800000000ULL, 0x000000000ULL}}},
+        {{{0x0000004010040000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401004000000000ULL, 0x000000000ULL}}, {{0x0000007000000000ULL, 0x000000000ULL}}},
+        {{{0x0000008020080000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802008000000000ULL, 0x000000000ULL}}, {{0x000000e000000000ULL, 0x000000000ULL}}},
+        {{{0x0000010040100000ULL, 0x000000000ULL}}, {{0x0000070000000000ULL, 0x000000000ULL}}, {{0x1004010000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000020080200000ULL, 0x000000000ULL}}, {{0x00000e0000000000ULL, 0x000000000ULL}}, {{0x2008020000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000040100400000ULL, 0x000000000ULL}}, {{0x00001c0000000000ULL, 0x000000000ULL}}, {{0x4010040000000000ULL, 0x000000000ULL}}, {{0x0000070000000000ULL, 0x000000000ULL}}},
+        {{{0x0000080200800000ULL, 0x000000000ULL}}, {{0x0000380000000000ULL, 0x000000000ULL}}, {{0x8020080000000000ULL, 0x000000000ULL}}, {{0x00000e0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000100401000000ULL, 0x000000000ULL}}, {{0x0000700000000000ULL, 0x000000000ULL}}, {{0x0040100000000000ULL, 0x000000001ULL}}, {{0x00001c0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000200802000000ULL, 0x000000000ULL}}, {{0x0000e00000000000ULL, 0x000000000ULL}}, {{0x0080200000000000ULL, 0x000000002ULL}}, {{0x0000380000000000ULL, 0x000000000ULL}}},
+        {{{0x0000401004000000ULL, 0x000000000ULL}}, {{0x0001c00000000000ULL, 0x000000000ULL}}, {{0x0100400000000000ULL, 0x000000004ULL}}, {{0x0000700000000000ULL, 0x000000000ULL}}},
+        {{{0x0000802008000000ULL, 0x000000000ULL}}, {{0x0003800000000000ULL, 0x000000000ULL}}, {{0x0200800000000000ULL, 0x000000008ULL}}, {{0x0000e00000000000ULL, 0x000000000ULL}}},
+        {{{0x0001004010000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401000000000000ULL, 0x000000010ULL}}, {{0x0001c00000000000ULL, 0x000000000ULL}}},
+        {{{0x0002008020000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802000000000000ULL, 0x000000020ULL}}, {{0x0003800000000000ULL, 0x000000000ULL}}},
+        {{{0x0004010040000000ULL, 0x000000000ULL}}, {{0x001c000000000000ULL, 0x000000000ULL}}, {{0x1004000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0008020080000000ULL, 0x000000000ULL}}, {{0x0038000000000000ULL, 0x000000000ULL}}, {{0x2008000000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0010040100000000ULL, 0x000000000ULL}}, {{0x0070000000000000ULL, 0x000000000ULL}}, {{0x4010000000000000ULL, 0x000000100ULL}}, {{0x001c000000000000ULL, 0x000000000ULL}}},
+        {{{0x0020080200000000ULL, 0x000000000ULL}}, {{0x00e0000000000000ULL, 0x000000000ULL}}, {{0x8020000000000000ULL, 0x000000200ULL}}, {{0x0038000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100400000000ULL, 0x000000000ULL}}, {{0x01c0000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x000000401ULL}}, {{0x0070000000000000ULL, 0x000000000ULL}}},
+        {{{0x0080200800000000ULL, 0x000000000ULL}}, {{0x0380000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x000000802ULL}}, {{0x00e0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0100401000000000ULL, 0x000000000ULL}}, {{0x0700000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x000001004ULL}}, {{0x01c0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0200802000000000ULL, 0x000000000ULL}}, {{0x0e00000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x000002008ULL}}, {{0x0380000000000000ULL, 0x000000000ULL}}},
+        {{{0x0401004000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x000004010ULL}}, {{0x0700000000000000ULL, 0x000000000ULL}}},
+        {{{0x0802008000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x000008020ULL}}, {{0x0e00000000000000ULL, 0x000000000ULL}}},
+        {{{0x1004010000000000ULL, 0x000000000ULL}}, {{0x7000000000000000ULL, 0x000000000ULL}}, {{0x1000000000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008020000000000ULL, 0x000000000ULL}}, {{0xe000000000000000ULL, 0x000000000ULL}}, {{0x2000000000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010040000000000ULL, 0x000000000ULL}}, {{0xc000000000000000ULL, 0x000000001ULL}}, {{0x4000000000000000ULL, 0x000040100ULL}}, {{0x7000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020080000000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x000000003ULL}}, {{0x8000000000000000ULL, 0x000080200ULL}}, {{0xe000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100000000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x000000007ULL}}, {{0x0000000000000000ULL, 0x000100401ULL}}, {{0xc000000000000000ULL, 0x000000001ULL}}},
+        {{{0x0080200000000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x00000000eULL}}, {{0x0000000000000000ULL, 0x000200802ULL}}, {{0x8000000000000000ULL, 0x000000003ULL}}},
+        {{{0x0100400000000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x00000001cULL}}, {{0x0000000000000000ULL, 0x000401004ULL}}, {{0x0000000000000000ULL, 0x000000007ULL}}},
+        {{{0x0200800000000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000038ULL}}, {{0x0000000000000000ULL, 0x000802008ULL}}, {{0x0000000000000000ULL, 0x00000000eULL}}},
+        {{{0x0401000000000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x001004010ULL}}, {{0x0000000000000000ULL, 0x00000001cULL}}},
+        {{{0x0802000000000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x002008020ULL}}, {{0x0000000000000000ULL, 0x000000038ULL}}},
+        {{{0x1004000000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x0000001c0ULL}}, {{0x0000000000000000ULL, 0x004010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008000000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000380ULL}}, {{0x0000000000000000ULL, 0x008020080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010000000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000700ULL}}, {{0x0000000000000000ULL, 0x010040100ULL}}, {{0x0000000000000000ULL, 0x0000001c0ULL}}},
+        {{{0x8020000000000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000000e00ULL}}, {{0x0000000000000000ULL, 0x020080200ULL}}, {{0x0000000000000000ULL, 0x000000380ULL}}},
+        {{{0x0040000000000000ULL, 0x000000401ULL}}, {{0x0000000000000000ULL, 0x000001c00ULL}}, {{0x0000000000000000ULL, 0x040100400ULL}}, {{0x0000000000000000ULL, 0x000000700ULL}}},
+        {{{0x0080000000000000ULL, 0x000000802ULL}}, {{0x0000000000000000ULL, 0x000003800ULL}}, {{0x0000000000000000ULL, 0x080200800ULL}}, {{0x0000000000000000ULL, 0x000000e00ULL}}},
+        {{{0x0100000000000000ULL, 0x000001004ULL}}, {{0x0000000000000000ULL, 0x000007000ULL}}, {{0x0000000000000000ULL, 0x100401000ULL}}, {{0x0000000000000000ULL, 0x000001c00ULL}}},
+        {{{0x0200000000000000ULL, 0x000002008ULL}}, {{0x0000000000000000ULL, 0x00000e000ULL}}, {{0x0000000000000000ULL, 0x200802000ULL}}, {{0x0000000000000000ULL, 0x000003800ULL}}},
+        {{{0x0400000000000000ULL, 0x000004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x401004000ULL}}, {{0x0000000000000000ULL, 0x000007000ULL}}},
+        {{{0x0800000000000000ULL, 0x000008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x802008000ULL}}, {{0x0000000000000000ULL, 0x00000e000ULL}}},
+        {{{0x1000000000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x000070000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2000000000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x0000e0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4000000000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x0001c0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000070000ULL}}},
+        {{{0x8000000000000000ULL, 0x000080200ULL}}, {{0x0000000000000000ULL, 0x000380000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0000e0000ULL}}},
+        {{{0x0000000000000000ULL, 0x000100401ULL}}, {{0x0000000000000000ULL, 0x000700000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0001c0000ULL}}},
+        {{{0x0000000000000000ULL, 0x000200802ULL}}, {{0x0000000000000000ULL, 0x000e00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000380000ULL}}},
+        {{{0x0000000000000000ULL, 0x000401004ULL}}, {{0x0000000000000000ULL, 0x001c00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000700000ULL}}},
+        {{{0x0000000000000000ULL, 0x000802008ULL}}, {{0x0000000000000000ULL, 0x003800000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000e00000ULL}}},
+        {{{0x0000000000000000ULL, 0x001004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x001c00000ULL}}},
+        {{{0x0000000000000000ULL, 0x002008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x003800000ULL}}},
+        {{{0x0000000000000000ULL, 0x004010040ULL}}, {{0x0000000000000000ULL, 0x01c000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x008020080ULL}}, {{0x0000000000000000ULL, 0x038000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x010040100ULL}}, {{0x0000000000000000ULL, 0x070000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x01c000000ULL}}},
+        {{{0x0000000000000000ULL, 0x020080200ULL}}, {{0x0000000000000000ULL, 0x0e0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x038000000ULL}}},
+        {{{0x0000000000000000ULL, 0x040100400ULL}}, {{0x0000000000000000ULL, 0x1c0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x070000000ULL}}},
+        {{{0x0000000000000000ULL, 0x080200800ULL}}, {{0x0000000000000000ULL, 0x380000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0e0000000ULL}}},
+        {{{0x0000000000000000ULL, 0x100401000ULL}}, {{0x0000000000000000ULL, 0x700000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x1c0000000ULL}}},
+        {{{0x0000000000000000ULL, 0x200802000ULL}}, {{0x0000000000000000ULL, 0xe00000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x380000000ULL}}},
+        {{{0x0000000000000000ULL, 0x401004000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x700000000ULL}}},
+        {{{0x0000000000000000ULL, 0x802008000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0xe00000000ULL}}},
+    },
+    { // length 4
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000000fULL, 0x000000000ULL}}, {{0x0000000040100401ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000001eULL, 0x000000000ULL}}, {{0x0000000080200802ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000003cULL, 0x000000000ULL}}, {{0x0000000100401004ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000078ULL, 0x000000000ULL}}, {{0x0000000200802008ULL, 0x000000000ULL}}, {{0x000000000000000fULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000000f0ULL, 0x000000000ULL}}, {{0x0000000401004010ULL, 0x000000000ULL}}, {{0x000000000000001eULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000001e0ULL, 0x000000000ULL}}, {{0x0000000802008020ULL, 0x000000000ULL}}, {{0x000000000000003cULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000003c0ULL, 0x000000000ULL}}, {{0x0000001004010040ULL, 0x000000000ULL}}, {{0x0000000000000078ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000002008020080ULL, 0x000000000ULL}}, {{0x00000000000000f0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000004010040100ULL, 0x000000000ULL}}, {{0x00000000000001e0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000008020080200ULL, 0x000000000ULL}}, {{0x00000000000003c0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000003c00ULL, 0x000000000ULL}}, {{0x0000010040100400ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000007800ULL, 0x000000000ULL}}, {{0x0000020080200800ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000f000ULL, 0x000000000ULL}}, {{0x0000040100401000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000001e000ULL, 0x000000000ULL}}, {{0x0000080200802000ULL, 0x000000000ULL}}, {{0x0000000000003c00ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000003c000ULL, 0x000000000ULL}}, {{0x0000100401004000ULL, 0x000000000ULL}}, {{0x0000000000007800ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000078000ULL, 0x000000000ULL}}, {{0x0000200802008000ULL, 0x000000000ULL}}, {{0x000000000000f000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000f0000ULL, 0x000000000ULL}}, {{0x0000401004010000ULL, 0x000000000ULL}}, {{0x000000000001e000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000802008020000ULL, 0x000000000ULL}}, {{0x000000000003c000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0001004010040000ULL, 0x000000000ULL}}, {{0x0000000000078000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0002008020080000ULL, 0x000000000ULL}}, {{0x00000000000f0000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000f00000ULL, 0x000000000ULL}}, {{0x0004010040100000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000001e00000ULL, 0x000000000ULL}}, {{0x0008020080200000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000003c00000ULL, 0x000000000ULL}}, {{0x0010040100400000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000007800000ULL, 0x000000000ULL}}, {{0x0020080200800000ULL, 0x000000000ULL}}, {{0x0000000000f00000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000f000000ULL, 0x000000000ULL}}, {{0x0040100401000000ULL, 0x000000000ULL}}, {{0x0000000001e00000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000001e000000ULL, 0x000000000ULL}}, {{0x0080200802000000ULL, 0x000000000ULL}}, {{0x0000000003c00000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000003c000000ULL, 0x000000000ULL}}, {{0x0100401004000000ULL, 0x000000000ULL}}, {{0x0000000007800000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200802008000000ULL, 0x000000000ULL}}, {{0x000000000f000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401004010000000ULL, 0x000000000ULL}}, {{0x000000001e000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802008020000000ULL, 0x000000000ULL}}, {{0x000000003c000000ULL, 0x000000000ULL}}},
+        {{{0x0000000040100401ULL, 0x000000000ULL}}, {{0x00000003c0000000ULL, 0x000000000ULL}}, {{0x1004010040000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000080200802ULL, 0x000000000ULL}}, {{0x0000000780000000ULL, 0x000000000ULL}}, {{0x2008020080000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000100401004ULL, 0x000000000ULL}}, {{0x0000000f00000000ULL, 0x000000000ULL}}, {{0x4010040100000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000200802008ULL, 0x000000000ULL}}, {{0x0000001e00000000ULL, 0x000000000ULL}}, {{0x8020080200000000ULL, 0x000000000ULL}}, {{0x00000003c0000000ULL, 0x000000000ULL}}},
+        {{{0x0000000401004010ULL, 0x000000000ULL}}, {{0x0000003c00000000ULL, 0x000000000ULL}}, {{0x0040100400000000ULL, 0x000000001ULL}}, {{0x0000000780000000ULL, 0x000000000ULL}}},
+        {{{0x0000000802008020ULL, 0x000000000ULL}}, {{0x0000007800000000ULL, 0x000000000ULL}}, {{0x0080200800000000ULL, 0x000000002ULL}}, {{0x0000000f00000000ULL, 0x000000000ULL}}},
+        {{{0x0000001004010040ULL, 0x000000000ULL}}, {{0x000000f000000000ULL, 0x000000000ULL}}, {{0x0100401000000000ULL, 0x000000004ULL}}, {{0x0000001e00000000ULL, 0x000000000ULL}}},
+        {{{0x0000002008020080ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200802000000000ULL, 0x000000008ULL}}, {{0x0000003c00000000ULL, 0x000000000ULL}}},
+        {{{0x0000004010040100ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401004000000000ULL, 0x000000010ULL}}, {{0x0000007800000000ULL, 0x000000000ULL}}},
+        {{{0x0000008020080200ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802008000000000ULL, 0x000000020ULL}}, {{0x000000f000000000ULL, 0x000000000ULL}}},
+        {{{0x0000010040100400ULL, 0x000000000ULL}}, {{0x00000f0000000000ULL, 0x000000000ULL}}, {{0x1004010000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000020080200800ULL, 0x000000000ULL}}, {{0x00001e0000000000ULL, 0x000000000ULL}}, {{0x2008020000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000040100401000ULL, 0x000000000ULL}}, {{0x00003c0000000000ULL, 0x000000000ULL}}, {{0x4010040000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000080200802000ULL, 0x000000000ULL}}, {{0x0000780000000000ULL, 0x000000000ULL}}, {{0x8020080000000000ULL, 0x000000200ULL}}, {{0x00000f0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000100401004000ULL, 0x000000000ULL}}, {{0x0000f00000000000ULL, 0x000000000ULL}}, {{0x0040100000000000ULL, 0x000000401ULL}}, {{0x00001e0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000200802008000ULL, 0x000000000ULL}}, {{0x0001e00000000000ULL, 0x000000000ULL}}, {{0x0080200000000000ULL, 0x000000802ULL}}, {{0x00003c0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000401004010000ULL, 0x000000000ULL}}, {{0x0003c00000000000ULL, 0x000000000ULL}}, {{0x0100400000000000ULL, 0x000001004ULL}}, {{0x0000780000000000ULL, 0x000000000ULL}}},
+        {{{0x0000802008020000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200800000000000ULL, 0x000002008ULL}}, {{0x0000f00000000000ULL, 0x000000000ULL}}},
+        {{{0x0001004010040000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401000000000000ULL, 0x000004010ULL}}, {{0x0001e00000000000ULL, 0x000000000ULL}}},
+        {{{0x0002008020080000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802000000000000ULL, 0x000008020ULL}}, {{0x0003c00000000000ULL, 0x000000000ULL}}},
+        {{{0x0004010040100000ULL, 0x000000000ULL}}, {{0x003c000000000000ULL, 0x000000000ULL}}, {{0x1004000000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0008020080200000ULL, 0x000000000ULL}}, {{0x0078000000000000ULL, 0x000000000ULL}}, {{0x2008000000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0010040100400000ULL, 0x000000000ULL}}, {{0x00f0000000000000ULL, 0x000000000ULL}}, {{0x4010000000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0020080200800000ULL, 0x000000000ULL}}, {{0x01e0000000000000ULL, 0x000000000ULL}}, {{0x8020000000000000ULL, 0x000080200ULL}}, {{0x003c000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100401000000ULL, 0x000000000ULL}}, {{0x03c0000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x000100401ULL}}, {{0x0078000000000000ULL, 0x000000000ULL}}},
+        {{{0x0080200802000000ULL, 0x000000000ULL}}, {{0x0780000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x000200802ULL}}, {{0x00f0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0100401004000000ULL, 0x000000000ULL}}, {{0x0f00000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x000401004ULL}}, {{0x01e0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0200802008000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x000802008ULL}}, {{0x03c0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0401004010000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x001004010ULL}}, {{0x0780000000000000ULL, 0x000000000ULL}}},
+        {{{0x0802008020000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x002008020ULL}}, {{0x0f00000000000000ULL, 0x000000000ULL}}},
+        {{{0x1004010040000000ULL, 0x000000000ULL}}, {{0xf000000000000000ULL, 0x000000000ULL}}, {{0x1000000000000000ULL, 0x004010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008020080000000ULL, 0x000000000ULL}}, {{0xe000000000000000ULL, 0x000000001ULL}}, {{0x2000000000000000ULL, 0x008020080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010040100000000ULL, 0x000000000ULL}}, {{0xc000000000000000ULL, 0x000000003ULL}}, {{0x4000000000000000ULL, 0x010040100ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020080200000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x000000007ULL}}, {{0x8000000000000000ULL, 0x020080200ULL}}, {{0xf000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100400000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x00000000fULL}}, {{0x0000000000000000ULL, 0x040100401ULL}}, {{0xe000000000000000ULL, 0x000000001ULL}}},
+        {{{0x0080200800000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x00000001eULL}}, {{0x0000000000000000ULL, 0x080200802ULL}}, {{0xc000000000000000ULL, 0x000000003ULL}}},
+        {{{0x0100401000000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x00000003cULL}}, {{0x0000000000000000ULL, 0x100401004ULL}}, {{0x8000000000000000ULL, 0x000000007ULL}}},
+        {{{0x0200802000000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x200802008ULL}}, {{0x0000000000000000ULL, 0x00000000fULL}}},
+        {{{0x0401004000000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x401004010ULL}}, {{0x0000000000000000ULL, 0x00000001eULL}}},
+        {{{0x0802008000000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x802008020ULL}}, {{0x0000000000000000ULL, 0x00000003cULL}}},
+        {{{0x1004010000000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x0000003c0ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008020000000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000780ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010040000000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000f00ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020080000000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000001e00ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0000003c0ULL}}},
+        {{{0x0040100000000000ULL, 0x000000401ULL}}, {{0x0000000000000000ULL, 0x000003c00ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000780ULL}}},
+        {{{0x0080200000000000ULL, 0x000000802ULL}}, {{0x0000000000000000ULL, 0x000007800ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000f00ULL}}},
+        {{{0x0100400000000000ULL, 0x000001004ULL}}, {{0x0000000000000000ULL, 0x00000f000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000001e00ULL}}},
+        {{{0x0200800000000000ULL, 0x000002008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000003c00ULL}}},
+        {{{0x0401000000000000ULL, 0x000004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000007800ULL}}},
+        {{{0x0802000000000000ULL, 0x000008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x00000f000ULL}}},
+        {{{0x1004000000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x0000f0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008000000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x0001e0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010000000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x0003c0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020000000000000ULL, 0x000080200ULL}}, {{0x0000000000000000ULL, 0x000780000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0000f0000ULL}}},
+        {{{0x0040000000000000ULL, 0x000100401ULL}}, {{0x0000000000000000ULL, 0x000f00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0001e0000ULL}}},
+        {{{0x0080000000000000ULL, 0x000200802ULL}}, {{0x0000000000000000ULL, 0x001e00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0003c0000ULL}}},
+        {{{0x0100000000000000ULL, 0x000401004ULL}}, {{0x0000000000000000ULL, 0x003c00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000780000ULL}}},
+        {{{0x0200000000000000ULL, 0x000802008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000f00000ULL}}},
+        {{{0x0400000000000000ULL, 0x001004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x001e00000ULL}}},
+        {{{0x0800000000000000ULL, 0x002008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x003c00000ULL}}},
+        {{{0x1000000000000000ULL, 0x004010040ULL}}, {{0x0000000000000000ULL, 0x03c000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2000000000000000ULL, 0x008020080ULL}}, {{0x0000000000000000ULL, 0x078000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4000000000000000ULL, 0x010040100ULL}}, {{0x0000000000000000ULL, 0x0f0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8000000000000000ULL, 0x020080200ULL}}, {{0x0000000000000000ULL, 0x1e0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x03c000000ULL}}},
+        {{{0x0000000000000000ULL, 0x040100401ULL}}, {{0x0000000000000000ULL, 0x3c0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x078000000ULL}}},
+        {{{0x0000000000000000ULL, 0x080200802ULL}}, {{0x0000000000000000ULL, 0x780000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0f0000000ULL}}},
+        {{{0x0000000000000000ULL, 0x100401004ULL}}, {{0x0000000000000000ULL, 0xf00000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x1e0000000ULL}}},
+        {{{0x0000000000000000ULL, 0x200802008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x3c0000000ULL}}},
+        {{{0x0000000000000000ULL, 0x401004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x780000000ULL}}},
+        {{{0x0000000000000000ULL, 0x802008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0xf00000000ULL}}},
+    },
+    { // length 5
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000001fULL, 0x000000000ULL}}, {{0x0000010040100401ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000003eULL, 0x000000000ULL}}, {{0x0000020080200802ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000007cULL, 0x000000000ULL}}, {{0x0000040100401004ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000000f8ULL, 0x000000000ULL}}, {{0x0000080200802008ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000001f0ULL, 0x000000000ULL}}, {{0x0000100401004010ULL, 0x000000000ULL}}, {{0x000000000000001fULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000003e0ULL, 0x000000000ULL}}, {{0x0000200802008020ULL, 0x000000000ULL}}, {{0x000000000000003eULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000401004010040ULL, 0x000000000ULL}}, {{0x000000000000007cULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000802008020080ULL, 0x000000000ULL}}, {{0x00000000000000f8ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0001004010040100ULL, 0x000000000ULL}}, {{0x00000000000001f0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0002008020080200ULL, 0x000000000ULL}}, {{0x00000000000003e0ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000007c00ULL, 0x000000000ULL}}, {{0x0004010040100400ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000000f800ULL, 0x000000000ULL}}, {{0x0008020080200800ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000001f000ULL, 0x000000000ULL}}, {{0x0010040100401000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000003e000ULL, 0x000000000ULL}}, {{0x0020080200802000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000007c000ULL, 0x000000000ULL}}, {{0x0040100401004000ULL, 0x000000000ULL}}, {{0x0000000000007c00ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000000000f8000ULL, 0x000000000ULL}}, {{0x0080200802008000ULL, 0x000000000ULL}}, {{0x000000000000f800ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0100401004010000ULL, 0x000000000ULL}}, {{0x000000000001f000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200802008020000ULL, 0x000000000ULL}}, {{0x000000000003e000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401004010040000ULL, 0x000000000ULL}}, {{0x000000000007c000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802008020080000ULL, 0x000000000ULL}}, {{0x00000000000f8000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000001f00000ULL, 0x000000000ULL}}, {{0x1004010040100000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000003e00000ULL, 0x000000000ULL}}, {{0x2008020080200000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000007c00000ULL, 0x000000000ULL}}, {{0x4010040100400000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000000f800000ULL, 0x000000000ULL}}, {{0x8020080200800000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000001f000000ULL, 0x000000000ULL}}, {{0x0040100401000000ULL, 0x000000001ULL}}, {{0x0000000001f00000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000003e000000ULL, 0x000000000ULL}}, {{0x0080200802000000ULL, 0x000000002ULL}}, {{0x0000000003e00000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0100401004000000ULL, 0x000000004ULL}}, {{0x0000000007c00000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200802008000000ULL, 0x000000008ULL}}, {{0x000000000f800000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401004010000000ULL, 0x000000010ULL}}, {{0x000000001f000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802008020000000ULL, 0x000000020ULL}}, {{0x000000003e000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x00000007c0000000ULL, 0x000000000ULL}}, {{0x1004010040000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000f80000000ULL, 0x000000000ULL}}, {{0x2008020080000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000001f00000000ULL, 0x000000000ULL}}, {{0x4010040100000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000003e00000000ULL, 0x000000000ULL}}, {{0x8020080200000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000007c00000000ULL, 0x000000000ULL}}, {{0x0040100400000000ULL, 0x000000401ULL}}, {{0x00000007c0000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x000000f800000000ULL, 0x000000000ULL}}, {{0x0080200800000000ULL, 0x000000802ULL}}, {{0x0000000f80000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0100401000000000ULL, 0x000001004ULL}}, {{0x0000001f00000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200802000000000ULL, 0x000002008ULL}}, {{0x0000003e00000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401004000000000ULL, 0x000004010ULL}}, {{0x0000007c00000000ULL, 0x000000000ULL}}},
+        {{{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802008000000000ULL, 0x000008020ULL}}, {{0x000000f800000000ULL, 0x000000000ULL}}},
+        {{{0x0000010040100401ULL, 0x000000000ULL}}, {{0x00001f0000000000ULL, 0x000000000ULL}}, {{0x1004010000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000020080200802ULL, 0x000000000ULL}}, {{0x00003e0000000000ULL, 0x000000000ULL}}, {{0x2008020000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000040100401004ULL, 0x000000000ULL}}, {{0x00007c0000000000ULL, 0x000000000ULL}}, {{0x4010040000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000080200802008ULL, 0x000000000ULL}}, {{0x0000f80000000000ULL, 0x000000000ULL}}, {{0x8020080000000000ULL, 0x000080200ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0000100401004010ULL, 0x000000000ULL}}, {{0x0001f00000000000ULL, 0x000000000ULL}}, {{0x0040100000000000ULL, 0x000100401ULL}}, {{0x00001f0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000200802008020ULL, 0x000000000ULL}}, {{0x0003e00000000000ULL, 0x000000000ULL}}, {{0x0080200000000000ULL, 0x000200802ULL}}, {{0x00003e0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000401004010040ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0100400000000000ULL, 0x000401004ULL}}, {{0x00007c0000000000ULL, 0x000000000ULL}}},
+        {{{0x0000802008020080ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200800000000000ULL, 0x000802008ULL}}, {{0x0000f80000000000ULL, 0x000000000ULL}}},
+        {{{0x0001004010040100ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0401000000000000ULL, 0x001004010ULL}}, {{0x0001f00000000000ULL, 0x000000000ULL}}},
+        {{{0x0002008020080200ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0802000000000000ULL, 0x002008020ULL}}, {{0x0003e00000000000ULL, 0x000000000ULL}}},
+        {{{0x0004010040100400ULL, 0x000000000ULL}}, {{0x007c000000000000ULL, 0x000000000ULL}}, {{0x1004000000000000ULL, 0x004010040ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0008020080200800ULL, 0x000000000ULL}}, {{0x00f8000000000000ULL, 0x000000000ULL}}, {{0x2008000000000000ULL, 0x008020080ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0010040100401000ULL, 0x000000000ULL}}, {{0x01f0000000000000ULL, 0x000000000ULL}}, {{0x4010000000000000ULL, 0x010040100ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0020080200802000ULL, 0x000000000ULL}}, {{0x03e0000000000000ULL, 0x000000000ULL}}, {{0x8020000000000000ULL, 0x020080200ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100401004000ULL, 0x000000000ULL}}, {{0x07c0000000000000ULL, 0x000000000ULL}}, {{0x0040000000000000ULL, 0x040100401ULL}}, {{0x007c000000000000ULL, 0x000000000ULL}}},
+        {{{0x0080200802008000ULL, 0x000000000ULL}}, {{0x0f80000000000000ULL, 0x000000000ULL}}, {{0x0080000000000000ULL, 0x080200802ULL}}, {{0x00f8000000000000ULL, 0x000000000ULL}}},
+        {{{0x0100401004010000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0100000000000000ULL, 0x100401004ULL}}, {{0x01f0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0200802008020000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0200000000000000ULL, 0x200802008ULL}}, {{0x03e0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0401004010040000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0400000000000000ULL, 0x401004010ULL}}, {{0x07c0000000000000ULL, 0x000000000ULL}}},
+        {{{0x0802008020080000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0800000000000000ULL, 0x802008020ULL}}, {{0x0f80000000000000ULL, 0x000000000ULL}}},
+        {{{0x1004010040100000ULL, 0x000000000ULL}}, {{0xf000000000000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008020080200000ULL, 0x000000000ULL}}, {{0xe000000000000000ULL, 0x000000003ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010040100400000ULL, 0x000000000ULL}}, {{0xc000000000000000ULL, 0x000000007ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020080200800000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x00000000fULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100401000000ULL, 0x000000001ULL}}, {{0x0000000000000000ULL, 0x00000001fULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0xf000000000000000ULL, 0x000000001ULL}}},
+        {{{0x0080200802000000ULL, 0x000000002ULL}}, {{0x0000000000000000ULL, 0x00000003eULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0xe000000000000000ULL, 0x000000003ULL}}},
+        {{{0x0100401004000000ULL, 0x000000004ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0xc000000000000000ULL, 0x000000007ULL}}},
+        {{{0x0200802008000000ULL, 0x000000008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x8000000000000000ULL, 0x00000000fULL}}},
+        {{{0x0401004010000000ULL, 0x000000010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x00000001fULL}}},
+        {{{0x0802008020000000ULL, 0x000000020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x00000003eULL}}},
+        {{{0x1004010040000000ULL, 0x000000040ULL}}, {{0x0000000000000000ULL, 0x0000007c0ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008020080000000ULL, 0x000000080ULL}}, {{0x0000000000000000ULL, 0x000000f80ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010040100000000ULL, 0x000000100ULL}}, {{0x0000000000000000ULL, 0x000001f00ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020080200000000ULL, 0x000000200ULL}}, {{0x0000000000000000ULL, 0x000003e00ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100400000000ULL, 0x000000401ULL}}, {{0x0000000000000000ULL, 0x000007c00ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0000007c0ULL}}},
+        {{{0x0080200800000000ULL, 0x000000802ULL}}, {{0x0000000000000000ULL, 0x00000f800ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000f80ULL}}},
+        {{{0x0100401000000000ULL, 0x000001004ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000001f00ULL}}},
+        {{{0x0200802000000000ULL, 0x000002008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000003e00ULL}}},
+        {{{0x0401004000000000ULL, 0x000004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000007c00ULL}}},
+        {{{0x0802008000000000ULL, 0x000008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x00000f800ULL}}},
+        {{{0x1004010000000000ULL, 0x000010040ULL}}, {{0x0000000000000000ULL, 0x0001f0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008020000000000ULL, 0x000020080ULL}}, {{0x0000000000000000ULL, 0x0003e0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010040000000000ULL, 0x000040100ULL}}, {{0x0000000000000000ULL, 0x0007c0000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020080000000000ULL, 0x000080200ULL}}, {{0x0000000000000000ULL, 0x000f80000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040100000000000ULL, 0x000100401ULL}}, {{0x0000000000000000ULL, 0x001f00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0001f0000ULL}}},
+        {{{0x0080200000000000ULL, 0x000200802ULL}}, {{0x0000000000000000ULL, 0x003e00000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0003e0000ULL}}},
+        {{{0x0100400000000000ULL, 0x000401004ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0007c0000ULL}}},
+        {{{0x0200800000000000ULL, 0x000802008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000f80000ULL}}},
+        {{{0x0401000000000000ULL, 0x001004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x001f00000ULL}}},
+        {{{0x0802000000000000ULL, 0x002008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x003e00000ULL}}},
+        {{{0x1004000000000000ULL, 0x004010040ULL}}, {{0x0000000000000000ULL, 0x07c000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x2008000000000000ULL, 0x008020080ULL}}, {{0x0000000000000000ULL, 0x0f8000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x4010000000000000ULL, 0x010040100ULL}}, {{0x0000000000000000ULL, 0x1f0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x8020000000000000ULL, 0x020080200ULL}}, {{0x0000000000000000ULL, 0x3e0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}},
+        {{{0x0040000000000000ULL, 0x040100401ULL}}, {{0x0000000000000000ULL, 0x7c0000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x07c000000ULL}}},
+        {{{0x0080000000000000ULL, 0x080200802ULL}}, {{0x0000000000000000ULL, 0xf80000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x0f8000000ULL}}},
+        {{{0x0100000000000000ULL, 0x100401004ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x1f0000000ULL}}},
+        {{{0x0200000000000000ULL, 0x200802008ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x3e0000000ULL}}},
+        {{{0x0400000000000000ULL, 0x401004010ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x7c0000000ULL}}},
+        {{{0x0800000000000000ULL, 0x802008020ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0x000000000ULL}}, {{0x0000000000000000ULL, 0xf80000000ULL}}},
+    },
+};
+
+#endif
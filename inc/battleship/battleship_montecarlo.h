@@ -0,0 +1,269 @@
+#ifndef BATTLESHIP_MONTECARLO
+#define BATTLESHIP_MONTECARLO
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+#include "battleship_board.h"
+#include "battleship_density.h"
+#include "battleship_sampler.h"
+#include "battleship_rng.h"
+
+// Monte Carlo targeting with a time budget.
+//
+// The DensityMap scores every ship on its own, so two ships may share a cell in its estimate. Here we
+// draw whole fleets that are consistent with everything we observed (the live placements of the ships
+// that are still afloat, which may not overlap) and count how often each cell is covered. The cell that
+// is covered most often is the most likely to hold a ship.
+//
+// The sampling stops at a deadline (MonteCarloConfig.budget_ms after the search started) or after
+// max_samples fleets, whichever comes first, and the best cell found so far is returned: the time spent
+// on a decision is bounded whatever the state of the board. With num_threads > 1, helper threads started
+// by monte_carlo_init sample alongside the calling thread and their counts are merged at the deadline.
+
+#define MONTE_CARLO_BATCH 32 // fleets drawn between two looks at the clock
+
+typedef struct MonteCarloConfig {
+
+    double budget_ms;   // time allowed for a decision
+    int num_threads;    // threads sampling, including the caller
+    int max_samples;    // stop after this many fleets, 0 for no limit
+
+} MonteCarloConfig;
+
+// Used by the AIs that don't have a MonteCarlo of their own
+MonteCarloConfig MONTE_CARLO_DEFAULTS = {2.0, 1, 0};
+
+struct MonteCarlo;
+
+typedef struct MonteCarloWorker {
+
+    struct MonteCarlo * mc;
+    XoshiroState rng;
+    int samples;
+    uint32_t covered[BB_CELLS];     // number of sampled fleets covering each cell
+
+} MonteCarloWorker;
+
+typedef struct MonteCarlo {
+
+    MonteCarloConfig config;
+    FleetSampler sampler;           // read only while the workers are sampling
+    double deadline;                // CLOCK_MONOTONIC, in seconds
+    MonteCarloWorker * workers;     // workers[0] is the calling thread
+    pthread_t * helpers;            // config.num_threads - 1 threads
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    pthread_cond_t done;
+    int generation;                 // incremented for every search
+    int busy;                       // helpers still sampling
+    bool quit;
+
+} MonteCarlo;
+
+double monte_carlo_now() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+void monte_carlo_sample(MonteCarloWorker * w) {
+
+    MonteCarlo * mc = w->mc;
+    int quota = mc->config.max_samples > 0 ? (mc->config.max_samples + mc->config.num_threads - 1) / mc->config.num_threads : INT32_MAX;
+    Fleet fleets[MONTE_CARLO_BATCH];
+
+    w->samples = 0;
+    memset(w->covered, 0, sizeof(w->covered));
+
+    do {
+
+        int wanted = quota - w->samples < MONTE_CARLO_BATCH ? quota - w->samples : MONTE_CARLO_BATCH;
+        int drawn = fleet_sampler_draw_many(&mc->sampler, &w->rng, fleets, wanted);
+
+        for (int b = 0; b < drawn; b ++) {
+
+            Bitboard mask = fleet_mask(&fleets[b]);
+
+            while ( !bb_is_empty(mask) ) {
+                w->covered[bb_pop_first(&mask)] ++;
+            }
+        }
+
+        w->samples += drawn;
+
+        if (drawn < wanted) return;
+
+    } while (w->samples < quota && monte_carlo_now() < mc->deadline);
+}
+
+void * monte_carlo_helper(void * arg) {
+
+    MonteCarloWorker * w = (MonteCarloWorker *) arg;
+    MonteCarlo * mc = w->mc;
+    int seen = 0;
+
+    pthread_mutex_lock(&mc->lock);
+
+    while (true) {
+
+        while (mc->generation == seen && !mc->quit) {
+            pthread_cond_wait(&mc->wake, &mc->lock);
+        }
+
+        if (mc->quit) break;
+
+        seen = mc->generation;
+        pthread_mutex_unlock(&mc->lock);
+
+        monte_carlo_sample(w);
+
+        pthread_mutex_lock(&mc->lock);
+        if (-- mc->busy == 0) pthread_cond_signal(&mc->done);
+    }
+
+    pthread_mutex_unlock(&mc->lock);
+
+    return NULL;
+}
+
+// Prepare a search and start its helper threads, if any
+void monte_carlo_init(MonteCarlo * mc, MonteCarloConfig config) {
+
+    if (config.num_threads < 1) config.num_threads = 1;
+
+    mc->config = config;
+    mc->generation = 0;
+    mc->busy = 0;
+    mc->quit = false;
+    mc->workers = (MonteCarloWorker *) malloc(sizeof(MonteCarloWorker) * config.num_threads);
+    mc->helpers = (pthread_t *) malloc(sizeof(pthread_t) * config.num_threads);
+
+    pthread_mutex_init(&mc->lock, NULL);
+    pthread_cond_init(&mc->wake, NULL);
+    pthread_cond_init(&mc->done, NULL);
+
+    for (int k = 0; k < config.num_threads; k ++) {
+        mc->workers[k].mc = mc;
+    }
+
+    for (int k = 1; k < config.num_threads; k ++) {
+        pthread_create(&mc->helpers[k - 1], NULL, monte_carlo_helper, &mc->workers[k]);
+    }
+}
+
+void monte_carlo_destroy(MonteCarlo * mc) {
+
+    pthread_mutex_lock(&mc->lock);
+    mc->quit = true;
+    pthread_cond_broadcast(&mc->wake);
+    pthread_mutex_unlock(&mc->lock);
+
+    for (int k = 1; k < mc->config.num_threads; k ++) {
+        pthread_join(mc->helpers[k - 1], NULL);
+    }
+
+    pthread_mutex_destroy(&mc->lock);
+    pthread_cond_destroy(&mc->wake);
+    pthread_cond_destroy(&mc->done);
+
+    free(mc->workers);
+    free(mc->helpers);
+}
+
+// Restrict the sampler to the ships that are still afloat and to the placements that are still alive
+// in `map`. Returns false if some ship has no placement left
+bool fleet_sampler_from_density(FleetSampler * fs, const DensityMap * map) {
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+
+    fs->num_ships = 0;
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        if ( (map->sunk >> s) & 1 ) continue;
+
+        int k = fs->num_ships ++;
+        fs->ships[k] = s;
+        fs->num_candidates[k] = 0;
+
+        for (int p = t->ship_start[s]; p < t->ship_start[s + 1]; p ++) {
+            if ( map->alive[p] ) {
+                fs->candidates[k][fs->num_candidates[k] ++] = p;
+            }
+        }
+
+        if (fs->num_candidates[k] == 0) return false;
+    }
+
+    return true;
+}
+
+// Untried cell covered by the most sampled fleets. When `prob` isn't NULL it receives the fraction of
+// the fleets covering each cell. Falls back to the density estimate if no fleet could be drawn
+int monte_carlo_best_cell(MonteCarlo * mc, const DensityMap * map, XoshiroState * rng, float prob[BB_CELLS]) {
+
+    if ( !fleet_sampler_from_density(&mc->sampler, map) || mc->sampler.num_ships == 0 ) {
+        if (prob) density_probabilities(map, prob);
+        return density_best_cell(map);
+    }
+
+    for (int k = 0; k < mc->config.num_threads; k ++) {
+        xoshiro_seed(&mc->workers[k].rng, xoshiro_next(rng));
+    }
+
+    mc->deadline = monte_carlo_now() + mc->config.budget_ms * 1E-3;
+
+    pthread_mutex_lock(&mc->lock);
+    mc->busy = mc->config.num_threads - 1;
+    mc->generation ++;
+    pthread_cond_broadcast(&mc->wake);
+    pthread_mutex_unlock(&mc->lock);
+
+    monte_carlo_sample(&mc->workers[0]);
+
+    pthread_mutex_lock(&mc->lock);
+    while (mc->busy > 0) {
+        pthread_cond_wait(&mc->done, &mc->lock);
+    }
+    pthread_mutex_unlock(&mc->lock);
+
+    // merge what every thread found
+    uint32_t covered[BB_CELLS] = {0};
+    int samples = 0;
+
+    for (int k = 0; k < mc->config.num_threads; k ++) {
+
+        samples += mc->workers[k].samples;
+
+        for (int c = 0; c < BB_CELLS; c ++) {
+            covered[c] += mc->workers[k].covered[c];
+        }
+    }
+
+    if (samples == 0) {
+        if (prob) density_probabilities(map, prob);
+        return density_best_cell(map);
+    }
+
+    int best = -1;
+    uint32_t best_covered = 0;
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+
+        if (prob) prob[c] = (float) covered[c] / samples;
+
+        if ( (best == -1 || covered[c] > best_covered) && !bb_test(map->tried, c) ) {
+            best = c;
+            best_covered = covered[c];
+        }
+    }
+
+    return best;
+}
+
+#endif
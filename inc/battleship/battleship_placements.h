@@ -0,0 +1,110 @@
+#ifndef BATTLESHIP_PLACEMENTS
+#define BATTLESHIP_PLACEMENTS
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "battleship_board.h"
+
+// List of every placement of every ship of the fleet on an empty board. Only the East and South
+// placements are listed: a North or West placement covers the same cells as a South or East one
+// starting at the other end. Placements are grouped by ship so that the placements of ship s are
+// [ship_start[s], ship_start[s + 1]), and cell_placements[c] lists the placements covering the cell c.
+
+#define MAX_PLACEMENTS 1000         // 2 directions * 100 cells * 5 ships is an upper bound
+#define MAX_CELL_PLACEMENTS 34      // 2 * (5 + 4 + 3 + 3 + 2) placements can go through a single cell
+#define MAX_SHIP_PLACEMENTS 180     // 2 * 10 * 9 placements for a ship of length 2
+
+typedef struct Placement {
+
+    Bitboard mask;
+    uint8_t ship;       // index in SHIP_TYPES
+    uint8_t length;
+    uint8_t cell;       // first cell (i * BOARD_SIZE + j) of the ship
+    char direction;     // 'E' or 'S'
+    uint8_t cells[5];
+
+} Placement;
+
+typedef struct PlacementTable {
+
+    bool ready;
+    int num_placements;
+    int ship_start[6];  // placements of ship s are [ship_start[s], ship_start[s + 1])
+    Placement placements[MAX_PLACEMENTS];
+    int cell_count[BB_CELLS];
+    uint16_t cell_placements[BB_CELLS][MAX_CELL_PLACEMENTS];
+
+} PlacementTable;
+
+PlacementTable PLACEMENT_TABLE = {false};
+
+// Run `init` exactly once even if several threads get here at the same time. `state` starts at 0, is 1
+// while `init` runs and 2 once it is done
+void run_once(int * state, void (*init)(void)) {
+
+    if (__atomic_load_n(state, __ATOMIC_ACQUIRE) == 2) return;
+
+    int expected = 0;
+
+    if ( __atomic_compare_exchange_n(state, &expected, 1, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) {
+        init();
+        __atomic_store_n(state, 2, __ATOMIC_RELEASE);
+        return;
+    }
+
+    while (__atomic_load_n(state, __ATOMIC_ACQUIRE) != 2);
+}
+
+void fill_placement_table(void) {
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+
+    t->num_placements = 0;
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+        t->cell_count[c] = 0;
+    }
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        t->ship_start[s] = t->num_placements;
+
+        for (int i = 0; i < BOARD_SIZE; i ++) {
+            for (int j = 0; j < BOARD_SIZE; j ++) {
+                for (int d = 0; d < 2; d ++) {
+
+                    Bitboard mask = PLACEMENT_MASKS[SHIP_LENGTHS[s]][i*BOARD_SIZE + j][d == 0 ? 1 : 2]; // East or South
+
+                    if ( bb_is_empty(mask) ) continue;
+
+                    int p = t->num_placements ++;
+                    Placement * pl = &t->placements[p];
+
+                    pl->mask = mask;
+                    pl->ship = s;
+                    pl->length = SHIP_LENGTHS[s];
+                    pl->cell = i*BOARD_SIZE + j;
+                    pl->direction = DIRECTIONS[d == 0 ? 1 : 2];
+
+                    for (int n = 0; n < pl->length; n ++) {
+                        int cell = bb_pop_first(&mask);
+                        pl->cells[n] = cell;
+                        t->cell_placements[cell][t->cell_count[cell] ++] = p;
+                    }
+                }
+            }
+        }
+    }
+
+    t->ship_start[NUM_SHIPS] = t->num_placements;
+    t->ready = true;
+}
+
+int PLACEMENT_TABLE_STATE = 0;
+
+// Fill PLACEMENT_TABLE, only the first call does any work. Safe to call from several threads
+void init_placement_table() {
+    run_once(&PLACEMENT_TABLE_STATE, fill_placement_table);
+}
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef BATTLESHIP_PROTOCOL
+#define BATTLESHIP_PROTOCOL
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "battleship_board.h"
+#include "battleship_engine.h"
+
+// Wire format of the battleship server (src/TP2/ex9/server.c).
+//
+// A client opens games against an AI hosted by the server, places its own fleet and then fires. Every
+// request is a ServerRequest and gets exactly one ServerResponse, in order, over the same stream socket.
+// Both have a fixed size, so a client can pipeline any number of requests, for as many games as it likes,
+// before reading the responses back.
+//
+//      REQUEST_NEW_GAME        `arg` is the AIStrategy of the opponent. The response carries the new game id
+//      REQUEST_PLACE           place SHIP_TYPES[ship] at `cell` towards `arg` ('N', 'E', 'S' or 'W')
+//      REQUEST_PLACE_RANDOM    place every ship that isn't placed yet at random
+//      REQUEST_SHOT            fire at `cell` once the fleet is complete. Unless that shot won the game, the
+//                              AI fires back straight away and its shot is part of the response
+//      REQUEST_END             give up the game
+//
+// A game is forgotten by the server when it is over, when it is given up and when its connection closes.
+// Messages are in the byte order of the machine: the socket is local.
+
+typedef enum RequestType {
+
+    REQUEST_NEW_GAME = 1,
+    REQUEST_PLACE,
+    REQUEST_PLACE_RANDOM,
+    REQUEST_SHOT,
+    REQUEST_END,
+
+} RequestType;
+
+typedef enum ResponseStatus {
+
+    STATUS_OK,
+    STATUS_BAD_REQUEST,     // unknown request type or argument
+    STATUS_NO_SUCH_GAME,    // the game doesn't exist or belongs to another connection
+    STATUS_BAD_PLACEMENT,   // the ship is already placed or doesn't fit there
+    STATUS_NOT_READY,       // shot fired before the fleet was complete
+    STATUS_INVALID_SHOT,    // out of the board or already attempted
+    STATUS_FULL,            // the server can't host any more games
+    STATUS_NO_FLEET,        // the AI couldn't place its fleet, the game wasn't opened
+
+} ResponseStatus;
+
+typedef enum GameWinner {
+
+    WINNER_NONE,
+    WINNER_CLIENT,
+    WINNER_SERVER,
+
+} GameWinner;
+
+#define NO_CELL 0xFF
+#define NO_SHIP 0xFF
+
+typedef struct ServerRequest {
+
+    uint8_t type;           // RequestType
+    uint8_t ship;
+    uint8_t cell;           // i * BOARD_SIZE + j
+    uint8_t arg;
+    uint32_t game;
+
+} ServerRequest;
+
+typedef struct ServerResponse {
+
+    uint8_t status;         // ResponseStatus
+    uint8_t outcome;        // ShotOutcome of the client's shot
+    uint8_t ship;           // ship that the client hit, NO_SHIP if it didn't hit anything
+    uint8_t winner;         // GameWinner
+    uint8_t reply_cell;     // cell the AI fired at, NO_CELL if it didn't fire
+    uint8_t reply_outcome;
+    uint8_t reply_ship;
+    uint8_t padding;
+    uint32_t game;
+
+} ServerResponse;
+
+static inline uint8_t encode_ship(int ship) {
+    return ship < 0 ? NO_SHIP : (uint8_t) ship;
+}
+
+#endif
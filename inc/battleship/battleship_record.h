@@ -0,0 +1,171 @@
+#ifndef BATTLESHIP_RECORD
+#define BATTLESHIP_RECORD
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "battleship_board.h"
+#include "battleship_engine.h"
+
+// Binary game records.
+//
+// Every game is stored as one GameRecord of a fixed size, so that a file of records is simply an array
+// that can be mmap'd and indexed without any parsing. A record holds the seed of the game, the fleet of
+// both sides and every valid shot in the order it was fired, two bytes per shot:
+//
+//      bits  0 - 6     cell (i * BOARD_SIZE + j)
+//      bits  7 - 8     outcome (SHOT_MISS, SHOT_HIT or SHOT_SUNK)
+//      bits  9 - 11    index of the ship that was hit
+//      bit   12        side that fired the shot
+//
+// Side k owns fleets[k] and shoots at fleets[1 - k]. A ship is stored in one byte as
+// its first cell times two, plus one if it extends towards the South (East otherwise), or as
+// RECORD_NO_SHIP if it wasn't on the board.
+//
+// Records are written in the byte order of the machine, they are meant to be mined where they are made.
+
+#define RECORD_MAGIC 0x31525342     // "BSR1"
+#define RECORD_MAX_SHOTS (2 * BB_CELLS)
+#define RECORD_HUMAN 0xFF           // players[k] for a human player, a AIStrategy otherwise
+#define RECORD_NO_WINNER 0xFF
+#define RECORD_NO_SHIP 0xFF         // fleets[k][s] of a ship that wasn't placed, rejected by record_is_valid
+
+typedef struct GameRecord {
+
+    uint32_t magic;
+    uint16_t num_shots;
+    uint8_t first_player;                   // side that fired the first shot
+    uint8_t winner;                         // side that sunk the other fleet, RECORD_NO_WINNER if unfinished
+    uint64_t seed;
+    uint8_t fleets[2][5];
+    uint8_t players[2];
+    uint16_t shots[RECORD_MAX_SHOTS];
+
+} GameRecord;
+
+void record_init(GameRecord * record, uint64_t seed, uint8_t player_0, uint8_t player_1) {
+
+    memset(record, 0, sizeof(GameRecord));
+
+    record->magic = RECORD_MAGIC;
+    record->seed = seed;
+    record->winner = RECORD_NO_WINNER;
+    record->players[0] = player_0;
+    record->players[1] = player_1;
+}
+
+// Store the fleet that is currently on `board` as the fleet of `side`. The ships that aren't on the
+// board are stored as RECORD_NO_SHIP
+void record_fleet(GameRecord * record, int side, Board board) {
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        if ( bb_is_empty(board->ships[s]) ) {
+            record->fleets[side][s] = RECORD_NO_SHIP;
+            continue;
+        }
+
+        int cell = bb_first(board->ships[s]);
+        bool south = !bb_test(board->ships[s], cell + 1);
+
+        record->fleets[side][s] = 2 * cell + south;
+    }
+}
+
+static inline uint16_t record_encode_shot(int side, int cell, ShotResult result) {
+    return cell | (result.outcome << 7) | ((result.ship < 0 ? 0 : result.ship) << 9) | (side << 12);
+}
+
+static inline int record_shot_cell(uint16_t shot) {
+    return shot & 0x7F;
+}
+
+static inline ShotOutcome record_shot_outcome(uint16_t shot) {
+    return (ShotOutcome) ((shot >> 7) & 3);
+}
+
+static inline int record_shot_ship(uint16_t shot) {
+    return (shot >> 9) & 7;
+}
+
+static inline int record_shot_side(uint16_t shot) {
+    return (shot >> 12) & 1;
+}
+
+// Append a shot, invalid shots aren't recorded. `record` may be NULL when the game isn't recorded
+void record_shot(GameRecord * record, int side, int i, int j, ShotResult result) {
+
+    if (record == NULL || result.outcome == SHOT_INVALID || record->num_shots == RECORD_MAX_SHOTS) return;
+
+    if (record->num_shots == 0) record->first_player = side;
+
+    record->shots[record->num_shots ++] = record_encode_shot(side, i * BOARD_SIZE + j, result);
+
+    if (result.game_over) record->winner = side;
+}
+
+// Check what readers index with: the header, a cell of the board for every ship, and for every shot a
+// cell of the board, a ship of the fleet and a valid outcome, no side firing twice at the same cell.
+// Whether the ships fit and don't overlap is checked by record_replay_fleet
+bool record_is_valid(const GameRecord * record) {
+
+    if (record->magic != RECORD_MAGIC || record->num_shots > RECORD_MAX_SHOTS || record->first_player > 1) {
+        return false;
+    }
+
+    if (record->winner > 1 && record->winner != RECORD_NO_WINNER) return false;
+
+    for (int side = 0; side < 2; side ++) {
+        for (int s = 0; s < NUM_SHIPS; s ++) {
+            if ( (record->fleets[side][s] >> 1) >= BB_CELLS ) return false;
+        }
+    }
+
+    Bitboard fired[2] = {bb_empty(), bb_empty()};
+
+    for (int n = 0; n < record->num_shots; n ++) {
+
+        uint16_t shot = record->shots[n];
+        int side = record_shot_side(shot);
+        int cell = record_shot_cell(shot);
+
+        if (cell >= BB_CELLS || record_shot_outcome(shot) == SHOT_INVALID || record_shot_ship(shot) >= NUM_SHIPS) {
+            return false;
+        }
+
+        if ( bb_test(fired[side], cell) ) return false;
+
+        bb_set(&fired[side], cell);
+    }
+
+    return true;
+}
+
+// Place the fleet of `side` on a fresh docking station, returns false if the record is corrupted
+bool record_replay_fleet(const GameRecord * record, int side, DockingStation * ds) {
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        int cell = record->fleets[side][s] >> 1;
+        char direction = record->fleets[side][s] & 1 ? 'S' : 'E';
+
+        if ( !deploy_ship(ds, cell / BOARD_SIZE, cell % BOARD_SIZE, direction, s) ) return false;
+    }
+
+    return true;
+}
+
+// Append `n` records to the file at `path`, returns false if the file couldn't be written
+bool record_append(const char * path, const GameRecord * records, size_t n) {
+
+    FILE * file = fopen(path, "ab");
+
+    if (file == NULL) return false;
+
+    bool ok = fwrite(records, sizeof(GameRecord), n, file) == n;
+
+    return fclose(file) == 0 && ok;
+}
+
+#endif
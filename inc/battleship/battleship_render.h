@@ -0,0 +1,169 @@
+#ifndef BATTLESHIP_RENDER
+#define BATTLESHIP_RENDER
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "battleship_board.h"
+
+// Frame buffered terminal renderer.
+//
+// print_docking_station issues one printf per cell and the game used to clear the screen by forking
+// `clear`. Instead, a whole frame is built in memory and written with a single write(2), starting with
+// the ANSI "cursor home" sequence and erasing what is left of every line, so the terminal never shows a
+// blank screen in between two frames. In diff mode only the cells that changed since the previous frame
+// are sent, each one as a cursor move followed by the new character.
+//
+// The layout is the one of print_docking_station: a header line, then one line per row with the
+// player's board on the left and what we know of the enemy board on the right.
+
+#define ANSI_HOME "\x1b[H"
+#define ANSI_ERASE_LINE "\x1b[K"
+#define ANSI_ERASE_BELOW "\x1b[J"
+
+typedef struct FrameBuffer {
+
+    char * data;
+    size_t len;
+    size_t cap;
+    bool has_previous;
+    char previous[2][BB_CELLS];     // characters drawn in the last frame, left and right board
+
+} FrameBuffer;
+
+// A zero initialized FrameBuffer is ready to use, the buffer is allocated by the first append
+
+void frame_free(FrameBuffer * fb) {
+    free(fb->data);
+    fb->data = NULL;
+}
+
+void frame_append(FrameBuffer * fb, const char * s, size_t n) {
+
+    if (fb->len + n > fb->cap) {
+        if (fb->cap == 0) fb->cap = 4096;
+        while (fb->len + n > fb->cap) fb->cap *= 2;
+        fb->data = (char *) realloc(fb->data, fb->cap);
+    }
+
+    memcpy(fb->data + fb->len, s, n);
+    fb->len += n;
+}
+
+void frame_puts(FrameBuffer * fb, const char * s) {
+    frame_append(fb, s, strlen(s));
+}
+
+void frame_putc(FrameBuffer * fb, char c) {
+    frame_append(fb, &c, 1);
+}
+
+// Move the cursor to the 1-based (line, column)
+void frame_move(FrameBuffer * fb, int line, int column) {
+
+    char seq[32];
+    int n = snprintf(seq, sizeof(seq), "\x1b[%d;%dH", line, column);
+    frame_append(fb, seq, n);
+}
+
+// Send the frame to the terminal in one write and empty the buffer
+void frame_flush(FrameBuffer * fb) {
+
+    fflush(stdout); // anything printf'd before the frame must come first
+
+    size_t written = 0;
+
+    while (written < fb->len) {
+
+        ssize_t n = write(STDOUT_FILENO, fb->data + written, fb->len - written);
+        if (n <= 0) break;
+        written += n;
+    }
+
+    fb->len = 0;
+}
+
+// Screen position of the cell (i, j) of the left (side = 0) or right (side = 1) board
+int frame_cell_line(int i) {
+    return 2 + i;
+}
+
+int frame_cell_column(int side, int j) {
+    return (side == 0 ? 3 : 28) + 2 * j;
+}
+
+void frame_current_cells(DockingStation * __left, DockingStation * __right, char cells[2][BB_CELLS]) {
+
+    for (int i = 0; i < BOARD_SIZE; i ++) {
+        for (int j = 0; j < BOARD_SIZE; j ++) {
+            cells[0][i*BOARD_SIZE + j] = get_location_char(__left->board, i, j);
+            cells[1][i*BOARD_SIZE + j] = get_location_char_enemy(__right->board, i, j);
+        }
+    }
+}
+
+// Draw both boards. With `diff` set (and a previous frame to compare to), only the cells that changed
+// are redrawn and the cursor is left below the boards
+void render_docking_station(FrameBuffer * fb, DockingStation * __left, DockingStation * __right, bool diff) {
+
+    char cells[2][BB_CELLS];
+    frame_current_cells(__left, __right, cells);
+
+    if (diff && fb->has_previous) {
+
+        for (int side = 0; side < 2; side ++) {
+            for (int c = 0; c < BB_CELLS; c ++) {
+
+                if (cells[side][c] == fb->previous[side][c]) continue;
+
+                frame_move(fb, frame_cell_line(c / BOARD_SIZE), frame_cell_column(side, c % BOARD_SIZE));
+                frame_putc(fb, cells[side][c]);
+            }
+        }
+
+        frame_move(fb, frame_cell_line(BOARD_SIZE) + 1, 1);
+
+    } else {
+
+        char number[8];
+
+        frame_puts(fb, ANSI_HOME "  ");
+
+        for (int side = 0; side < 2; side ++) {
+
+            for (int k = 0; k < BOARD_SIZE; k ++) {
+                snprintf(number, sizeof(number), "%d ", NUMBERS[k]);
+                frame_puts(fb, number);
+            }
+
+            frame_puts(fb, side == 0 ? " |  " : ANSI_ERASE_LINE "\n");
+        }
+
+        for (int i = 0; i < BOARD_SIZE; i ++) {
+
+            frame_putc(fb, LETTERS[i]);
+            frame_putc(fb, ' ');
+
+            for (int side = 0; side < 2; side ++) {
+
+                for (int j = 0; j < BOARD_SIZE; j ++) {
+                    frame_putc(fb, cells[side][i*BOARD_SIZE + j]);
+                    frame_putc(fb, ' ');
+                }
+
+                frame_puts(fb, side == 0 ? "  |  " : ANSI_ERASE_LINE "\n");
+            }
+        }
+
+        frame_puts(fb, ANSI_ERASE_LINE "\n" ANSI_ERASE_BELOW);
+    }
+
+    memcpy(fb->previous, cells, sizeof(cells));
+    fb->has_previous = true;
+
+    frame_flush(fb);
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef BATTLESHIP_RNG
+#define BATTLESHIP_RNG
+
+#include <stdint.h>
+
+// Self contained xoshiro256** generator. Unlike `unif` from ejovo_rand.h, which draws from the global
+// XOSHIRO_RNG, every XoshiroState is independent, so each thread (or each AI) can own one.
+
+typedef struct XoshiroState {
+
+    uint64_t s[4];
+
+} XoshiroState;
+
+static inline uint64_t xoshiro_rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// splitmix64 is used to expand a single 64 bit seed into the 256 bits of state
+static inline uint64_t splitmix64(uint64_t * x) {
+
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void xoshiro_seed(XoshiroState * rng, uint64_t seed) {
+
+    for (int i = 0; i < 4; i ++) {
+        rng->s[i] = splitmix64(&seed);
+    }
+}
+
+static inline uint64_t xoshiro_next(XoshiroState * rng) {
+
+    uint64_t * s = rng->s;
+    uint64_t result = xoshiro_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = xoshiro_rotl(s[3], 45);
+
+    return result;
+}
+
+// uniform integer in [0, n), using Lemire's multiply and shift (the bias is < n / 2^64)
+static inline uint64_t xoshiro_below(XoshiroState * rng, uint64_t n) {
+    return (uint64_t) (((unsigned __int128) xoshiro_next(rng) * n) >> 64);
+}
+
+// uniform integer in [a, b], same contract as `unif`
+static inline int xoshiro_unif(XoshiroState * rng, int a, int b) {
+    return a + (int) xoshiro_below(rng, (uint64_t) (b - a + 1));
+}
+
+#endif
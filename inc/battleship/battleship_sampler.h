@@ -0,0 +1,253 @@
+#ifndef BATTLESHIP_SAMPLER
+#define BATTLESHIP_SAMPLER
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "battleship_board.h"
+#include "battleship_placements.h"
+#include "battleship_rng.h"
+
+// Uniform fleet placement.
+//
+// A FleetSampler is prepared once for a set of ships and the cells that are already occupied: for each
+// ship it lists the placements that avoid the occupied cells. Drawing a fleet then picks one placement
+// per ship directly by index (no per-cell retries) and accepts the fleet if no two ships overlap. Since
+// every ship is drawn uniformly and independently, an accepted fleet is uniform over the set of legal
+// fleets. On the empty 10x10 board about 40% of the fleets are accepted, so a draw costs a few
+// dozen table lookups and ANDs.
+//
+// On crowded boards few fleets are accepted. After MAX_FLEET_ATTEMPTS rejected fleets, the fleet is drawn
+// exactly instead: the legal fleets are counted by going through the candidate lists, a rank is drawn
+// uniformly below the count and the fleet of that rank is rebuilt, each ship taking the placement whose
+// completions contain the rank. Both ways give a uniform fleet, so the draw stays exactly uniform, and it
+// only fails when there is no legal fleet at all. The count visits every partial fleet, which would be
+// far too slow on an open board, but with an acceptance a the rejection gives up with probability
+// (1 - a)^256: below 1e-5 for a > 5%, where the 10x10 board has millions of fleets, while on boards
+// with a < 3% the count takes less than a millisecond.
+
+#define MAX_FLEET_ATTEMPTS 256
+
+typedef struct Fleet {
+
+    uint16_t placements[5]; // index in PLACEMENT_TABLE of the placement of each ship, indexed like SHIP_TYPES
+    uint8_t ships;          // bit s is set if SHIP_TYPES[s] is part of the fleet
+
+} Fleet;
+
+typedef struct FleetSampler {
+
+    int num_ships;
+    uint8_t ships[5];                                   // ships to place, longest first
+    int num_candidates[5];
+    uint16_t candidates[5][MAX_SHIP_PLACEMENTS];        // placements of ships[k] avoiding the occupied cells
+
+} FleetSampler;
+
+// Prepare a sampler for the ships whose bits are set in `ship_set` (bit s for SHIP_TYPES[s]) on a board
+// where the cells of `occupied` are not available
+void fleet_sampler_init(FleetSampler * fs, Bitboard occupied, uint8_t ship_set) {
+
+    init_placement_table();
+    PlacementTable * t = &PLACEMENT_TABLE;
+
+    fs->num_ships = 0;
+
+    // SHIP_LENGTHS is sorted longest first, and long ships are the most likely to collide
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        if ( !((ship_set >> s) & 1) ) continue;
+
+        int k = fs->num_ships ++;
+        fs->ships[k] = s;
+        fs->num_candidates[k] = 0;
+
+        for (int p = t->ship_start[s]; p < t->ship_start[s + 1]; p ++) {
+            if ( !bb_intersects(t->placements[p].mask, occupied) ) {
+                fs->candidates[k][fs->num_candidates[k] ++] = p;
+            }
+        }
+    }
+}
+
+FleetSampler FULL_FLEET_SAMPLER;
+int FULL_FLEET_SAMPLER_STATE = 0;
+
+void fill_full_fleet_sampler(void) {
+    fleet_sampler_init(&FULL_FLEET_SAMPLER, bb_empty(), (1 << NUM_SHIPS) - 1);
+}
+
+// Sampler for the whole fleet on an empty board, prepared once and shared by every thread
+const FleetSampler * full_fleet_sampler() {
+
+    run_once(&FULL_FLEET_SAMPLER_STATE, fill_full_fleet_sampler);
+    return &FULL_FLEET_SAMPLER;
+}
+
+// Try to draw a fleet by rejection, returns false if MAX_FLEET_ATTEMPTS fleets were rejected
+bool fleet_sampler_reject(const FleetSampler * fs, XoshiroState * rng, Fleet * fleet) {
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+
+    for (int attempt = 0; attempt < MAX_FLEET_ATTEMPTS; attempt ++) {
+
+        Bitboard taken = bb_empty();
+        int k = 0;
+
+        for (; k < fs->num_ships; k ++) {
+
+            uint16_t p = fs->candidates[k][xoshiro_below(rng, fs->num_candidates[k])];
+            Bitboard mask = t->placements[p].mask;
+
+            if ( bb_intersects(mask, taken) ) break;
+
+            fleet->placements[fs->ships[k]] = p;
+            taken = bb_or(taken, mask);
+        }
+
+        if (k == fs->num_ships) return true;
+    }
+
+    return false;
+}
+
+// Number of ways to place the ships k, k + 1, ... of the sampler avoiding the cells of `taken`
+uint64_t fleet_sampler_count(const FleetSampler * fs, int k, Bitboard taken) {
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+    uint64_t count = 0;
+
+    for (int n = 0; n < fs->num_candidates[k]; n ++) {
+
+        Bitboard mask = t->placements[fs->candidates[k][n]].mask;
+
+        if ( bb_intersects(mask, taken) ) continue;
+
+        count += k == fs->num_ships - 1 ? 1 : fleet_sampler_count(fs, k + 1, bb_or(taken, mask));
+    }
+
+    return count;
+}
+
+typedef struct FleetRank {
+
+    uint64_t rank;          // among the legal fleets, in the order of the candidate lists
+    int slot;               // fleet that receives it
+
+} FleetRank;
+
+int compare_fleet_ranks(const void * a, const void * b) {
+
+    uint64_t x = ((const FleetRank *) a)->rank, y = ((const FleetRank *) b)->rank;
+    return (x > y) - (x < y);
+}
+
+// Set the placements of the ships k, k + 1, ... in the fleets of the `n` sorted ranks. `first` is the rank
+// of the first completion of `taken`, so every rank is in [first, first + fleet_sampler_count(fs, k, taken))
+void fleet_sampler_unrank(const FleetSampler * fs, int k, Bitboard taken, uint64_t first, const FleetRank * ranks,
+                          int n, Fleet * fleets) {
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+    int i = 0;
+
+    for (int c = 0; c < fs->num_candidates[k] && i < n; c ++) {
+
+        uint16_t p = fs->candidates[k][c];
+        Bitboard mask = t->placements[p].mask;
+
+        if ( bb_intersects(mask, taken) ) continue;
+
+        Bitboard next = bb_or(taken, mask);
+        uint64_t count = k == fs->num_ships - 1 ? 1 : fleet_sampler_count(fs, k + 1, next);
+        int j = i;
+
+        while (j < n && ranks[j].rank < first + count) {
+            fleets[ranks[j ++].slot].placements[fs->ships[k]] = p;
+        }
+
+        if (j > i && k < fs->num_ships - 1) {
+            fleet_sampler_unrank(fs, k + 1, next, first, ranks + i, j - i, fleets);
+        }
+
+        first += count;
+        i = j;
+    }
+}
+
+// Fill `fleets` with `n` independent uniform fleets, returns n, or 0 if there is no legal fleet. Once a
+// fleet has been rejected MAX_FLEET_ATTEMPTS times the board is crowded: that fleet and the ones left are
+// drawn together by a single count and a single walk through the candidate lists
+int fleet_sampler_draw_many(const FleetSampler * fs, XoshiroState * rng, Fleet * fleets, int n) {
+
+    uint8_t ships = 0;
+
+    for (int k = 0; k < fs->num_ships; k ++) {
+
+        if (fs->num_candidates[k] == 0) return 0;
+        ships |= 1 << fs->ships[k];
+    }
+
+    int i = 0;
+
+    for (; i < n; i ++) {
+
+        fleets[i].ships = ships;
+
+        if ( !fleet_sampler_reject(fs, rng, &fleets[i]) ) break;
+    }
+
+    if (i == n) return n;
+
+    uint64_t total = fs->num_ships ? fleet_sampler_count(fs, 0, bb_empty()) : 1;
+
+    if (total == 0) return 0;
+
+    FleetRank * ranks = (FleetRank *) malloc(sizeof(FleetRank) * (n - i));
+
+    for (int r = 0; r < n - i; r ++) {
+        fleets[i + r].ships = ships;
+        ranks[r].rank = xoshiro_below(rng, total);
+        ranks[r].slot = i + r;
+    }
+
+    qsort(ranks, n - i, sizeof(FleetRank), compare_fleet_ranks);
+
+    if (fs->num_ships) fleet_sampler_unrank(fs, 0, bb_empty(), 0, ranks, n - i, fleets);
+
+    free(ranks);
+
+    return n;
+}
+
+// Draw a fleet, returns false if there is no legal fleet
+bool fleet_sampler_draw(const FleetSampler * fs, XoshiroState * rng, Fleet * fleet) {
+    return fleet_sampler_draw_many(fs, rng, fleet, 1) == 1;
+}
+
+// Mask of every cell covered by the fleet
+Bitboard fleet_mask(const Fleet * fleet) {
+
+    Bitboard mask = bb_empty();
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+        if ( (fleet->ships >> s) & 1 ) {
+            mask = bb_or(mask, PLACEMENT_TABLE.placements[fleet->placements[s]].mask);
+        }
+    }
+
+    return mask;
+}
+
+// Place every ship of the fleet on the board
+void place_fleet(Board board, const Fleet * fleet) {
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+
+        if ( !((fleet->ships >> s) & 1) ) continue;
+
+        Placement * pl = &PLACEMENT_TABLE.placements[fleet->placements[s]];
+        place_ship(pl->cell / BOARD_SIZE, pl->cell % BOARD_SIZE, pl->direction, board, SHIP_TYPES[s], pl->length);
+    }
+}
+
+#endif
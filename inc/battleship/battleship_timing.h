@@ -0,0 +1,126 @@
+#ifndef BATTLESHIP_TIMING
+#define BATTLESHIP_TIMING
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "battleship_latency.h"
+
+// Where the time of a game goes.
+//
+// The game loop is split in phases (TIMING_PHASE_NAMES) and every time a phase runs its duration is added
+// to a LatencyHistogram. Timing is off unless a program calls timing_init_from_env with the environment
+// variable BATTLESHIP_TIMING set:
+//
+//      BATTLESHIP_TIMING=report        print the histogram of every phase on exit
+//      BATTLESHIP_TIMING=<path>        write the counters of every phase to <path> on exit
+//
+// When it is off, an instrumented phase costs a load and a branch. The counters are not shared between
+// threads: only the interactive programs (ex9, spectate) turn timing on, tournaments never do.
+
+typedef enum TimingPhase {
+
+    PHASE_PLACEMENT,    // ai_place_ships
+    PHASE_DECISION,     // the AI choosing its target and learning from the outcome
+    PHASE_INPUT,        // waiting for the human player
+    PHASE_RESOLUTION,   // the engine resolving a shot
+    PHASE_RENDER,       // drawing the boards
+    PHASE_SLEEP,        // dsleep
+
+} TimingPhase;
+
+#define NUM_TIMING_PHASES 6
+
+const char * TIMING_PHASE_NAMES[NUM_TIMING_PHASES] = {"placement", "decision", "input", "resolution", "render", "sleep"};
+
+typedef struct Timing {
+
+    bool enabled;
+    const char * counters_path;     // NULL to print a report instead
+    uint64_t start_ns;
+    LatencyHistogram phases[NUM_TIMING_PHASES];
+
+} Timing;
+
+Timing TIMING = {false};
+
+static inline uint64_t timing_start() {
+    return TIMING.enabled ? latency_now_ns() : 0;
+}
+
+static inline void timing_stop(TimingPhase phase, uint64_t start) {
+    if (TIMING.enabled) latency_record(&TIMING.phases[phase], latency_now_ns() - start);
+}
+
+// For a phase that runs in several pieces, `ns` being the time of all of the pieces
+static inline void timing_record(TimingPhase phase, uint64_t ns) {
+    if (TIMING.enabled) latency_record(&TIMING.phases[phase], ns);
+}
+
+// Print the share of the wall time spent in each phase, then the histogram of each phase
+void timing_report(FILE * out) {
+
+    uint64_t wall = latency_now_ns() - TIMING.start_ns;
+    uint64_t accounted = 0;
+
+    fprintf(out, "\nWall time %.3f s\n", wall * 1E-9);
+
+    for (int p = 0; p < NUM_TIMING_PHASES; p ++) {
+        const LatencyHistogram * h = &TIMING.phases[p];
+        accounted += h->sum_ns;
+        fprintf(out, "  %-12s %10.3f s  %5.1f%%\n", TIMING_PHASE_NAMES[p], h->sum_ns * 1E-9, wall ? 100.0 * h->sum_ns / wall : 0);
+    }
+
+    fprintf(out, "  %-12s %10.3f s  %5.1f%%\n\n", "other", (wall - accounted) * 1E-9, wall ? 100.0 * (wall - accounted) / wall : 0);
+
+    fflush(out);
+
+    for (int p = 0; p < NUM_TIMING_PHASES; p ++) {
+        latency_print(TIMING_PHASE_NAMES[p], &TIMING.phases[p]);
+    }
+}
+
+// One line per phase: name, count, total, p50, p99 and max, in nanoseconds
+bool timing_write_counters(const char * path) {
+
+    FILE * file = fopen(path, "w");
+
+    if (file == NULL) return false;
+
+    fprintf(file, "wall_ns %llu\n", (unsigned long long) (latency_now_ns() - TIMING.start_ns));
+
+    for (int p = 0; p < NUM_TIMING_PHASES; p ++) {
+        const LatencyHistogram * h = &TIMING.phases[p];
+        fprintf(file, "%s %llu %llu %llu %llu %llu\n", TIMING_PHASE_NAMES[p], (unsigned long long) h->total,
+                (unsigned long long) h->sum_ns, (unsigned long long) latency_percentile(h, 0.5),
+                (unsigned long long) latency_percentile(h, 0.99), (unsigned long long) h->max_ns);
+    }
+
+    return fclose(file) == 0;
+}
+
+void timing_at_exit(void) {
+
+    if (!TIMING.enabled) return;
+
+    if (TIMING.counters_path == NULL) timing_report(stdout);
+    else if ( !timing_write_counters(TIMING.counters_path) ) perror(TIMING.counters_path);
+}
+
+// Turn timing on if BATTLESHIP_TIMING is set, the summary is written when the program exits
+void timing_init_from_env() {
+
+    const char * value = getenv("BATTLESHIP_TIMING");
+
+    if (value == NULL || value[0] == '\0') return;
+
+    TIMING.enabled = true;
+    TIMING.counters_path = strcmp(value, "report") == 0 ? NULL : value;
+    TIMING.start_ns = latency_now_ns();
+
+    atexit(timing_at_exit);
+}
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef BATTLESHIP_TRANSPOSITION
+#define BATTLESHIP_TRANSPOSITION
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "battleship_board.h"
+#include "battleship_engine.h"
+#include "battleship_placements.h"
+#include "battleship_rng.h"
+
+// Cache of targeting decisions.
+//
+// What an AI knows about the enemy board is the outcome of every shot (a miss, or a hit on a given ship)
+// and the set of ships that were sunk. The density and Monte Carlo decisions only depend on that, so
+// games that reach the same observed state (the first move of every game, common openings, ...) can
+// reuse the decision instead of evaluating it again.
+//
+// The observed state is hashed with Zobrist keys: one random key per (cell, observation) and per sunk
+// ship, xor'd together. The hash is updated with a single xor per shot (zobrist_observe).
+//
+// A TranspositionTable maps a hash to the chosen cell and the probability map it was chosen from. The
+// table has a fixed number of slots, a new entry replaces whatever was in its slot. Slots are guarded
+// by a set of striped locks so that one table can be shared by every thread of a tournament, and the
+// lookups and hits are counted to report the hit rate.
+
+/**========================================================================
+ *                           Zobrist keys
+ *========================================================================**/
+
+// key of a cell observed as a miss (0) or as a hit on SHIP_TYPES[s] (1 + s)
+uint64_t ZOBRIST_CELL[BB_CELLS][6];
+uint64_t ZOBRIST_SUNK[5];
+uint64_t ZOBRIST_STRATEGY[8];   // decisions of different strategies are cached separately
+int ZOBRIST_STATE = 0;
+
+void fill_zobrist_keys(void) {
+
+    uint64_t x = 0x5A0B1E57C0FFEE11ULL; // fixed so that hashes are the same from one run to the other
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+        for (int k = 0; k < 6; k ++) {
+            ZOBRIST_CELL[c][k] = splitmix64(&x);
+        }
+    }
+
+    for (int s = 0; s < NUM_SHIPS; s ++) {
+        ZOBRIST_SUNK[s] = splitmix64(&x);
+    }
+
+    for (int k = 0; k < 8; k ++) {
+        ZOBRIST_STRATEGY[k] = splitmix64(&x);
+    }
+}
+
+void init_zobrist_keys() {
+    run_once(&ZOBRIST_STATE, fill_zobrist_keys);
+}
+
+// Hash of the observed state after a shot at `cell` that gave `result`, starting from `hash`
+uint64_t zobrist_observe(uint64_t hash, int cell, ShotResult result) {
+
+    if (result.outcome == SHOT_INVALID) return hash;
+
+    init_zobrist_keys();
+
+    if (result.outcome == SHOT_MISS) return hash ^ ZOBRIST_CELL[cell][0];
+
+    hash ^= ZOBRIST_CELL[cell][1 + result.ship];
+
+    return result.outcome == SHOT_SUNK ? hash ^ ZOBRIST_SUNK[result.ship] : hash;
+}
+
+/**========================================================================
+ *                           Transposition table
+ *========================================================================**/
+
+#define TRANSPOSITION_LOCKS 64
+
+typedef struct TranspositionEntry {
+
+    uint64_t key;               // 0 for an empty slot
+    int cell;
+    float prob[BB_CELLS];
+
+} TranspositionEntry;
+
+typedef struct TranspositionTable {
+
+    int num_entries;            // a power of two
+    TranspositionEntry * entries;
+    pthread_mutex_t locks[TRANSPOSITION_LOCKS];
+    uint64_t lookups;
+    uint64_t hits;
+    uint64_t stores;
+
+} TranspositionTable;
+
+// Table with at least `num_entries` slots (rounded up to a power of two)
+TranspositionTable * transposition_new(int num_entries) {
+
+    TranspositionTable * tt = (TranspositionTable *) malloc(sizeof(TranspositionTable));
+
+    tt->num_entries = 1;
+    while (tt->num_entries < num_entries) tt->num_entries *= 2;
+
+    tt->entries = (TranspositionEntry *) calloc(tt->num_entries, sizeof(TranspositionEntry));
+    tt->lookups = tt->hits = tt->stores = 0;
+
+    for (int k = 0; k < TRANSPOSITION_LOCKS; k ++) {
+        pthread_mutex_init(&tt->locks[k], NULL);
+    }
+
+    init_zobrist_keys();
+
+    return tt;
+}
+
+void transposition_free(TranspositionTable * tt) {
+
+    for (int k = 0; k < TRANSPOSITION_LOCKS; k ++) {
+        pthread_mutex_destroy(&tt->locks[k]);
+    }
+
+    free(tt->entries);
+    free(tt);
+}
+
+// Look `key` up. On a hit, the cached cell is returned and its probability map is copied to `prob`
+// (unless NULL). Returns -1 on a miss
+int transposition_probe(TranspositionTable * tt, uint64_t key, float prob[BB_CELLS]) {
+
+    int slot = key & (tt->num_entries - 1);
+    int cell = -1;
+
+    __atomic_add_fetch(&tt->lookups, 1, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&tt->locks[slot % TRANSPOSITION_LOCKS]);
+
+    TranspositionEntry * e = &tt->entries[slot];
+
+    if (e->key == key && key != 0) {
+        cell = e->cell;
+        if (prob) memcpy(prob, e->prob, sizeof(e->prob));
+    }
+
+    pthread_mutex_unlock(&tt->locks[slot % TRANSPOSITION_LOCKS]);
+
+    if (cell != -1) __atomic_add_fetch(&tt->hits, 1, __ATOMIC_RELAXED);
+
+    return cell;
+}
+
+void transposition_store(TranspositionTable * tt, uint64_t key, int cell, const float prob[BB_CELLS]) {
+
+    int slot = key & (tt->num_entries - 1);
+
+    __atomic_add_fetch(&tt->stores, 1, __ATOMIC_RELAXED);
+
+    pthread_mutex_lock(&tt->locks[slot % TRANSPOSITION_LOCKS]);
+
+    TranspositionEntry * e = &tt->entries[slot];
+
+    e->key = key;
+    e->cell = cell;
+    memcpy(e->prob, prob, sizeof(e->prob));
+
+    pthread_mutex_unlock(&tt->locks[slot % TRANSPOSITION_LOCKS]);
+}
+
+double transposition_hit_rate(const TranspositionTable * tt) {
+
+    uint64_t lookups = __atomic_load_n(&tt->lookups, __ATOMIC_RELAXED);
+    return lookups ? (double) __atomic_load_n(&tt->hits, __ATOMIC_RELAXED) / lookups : 0;
+}
+
+#endif
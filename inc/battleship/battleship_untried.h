@@ -0,0 +1,54 @@
+#ifndef BATTLESHIP_UNTRIED
+#define BATTLESHIP_UNTRIED
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "battleship_bitboard.h"
+
+// Set of the cells that haven't been fired at yet, stored as a dense array so that the k-th untried
+// cell is a single load and a random untried cell can be drawn in constant time. `pos` is the inverse
+// of `cells`, so removing a cell swaps it with the last one of the array.
+
+typedef struct UntriedCells {
+
+    bool ready;
+    int count;
+    uint8_t cells[BB_CELLS];    // cells[0 .. count) are untried
+    uint8_t pos[BB_CELLS];      // index of each cell in `cells`
+
+} UntriedCells;
+
+// Fill the set with every cell that is not in `attempted`
+void untried_reset(UntriedCells * u, Bitboard attempted) {
+
+    u->count = 0;
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+
+        u->pos[c] = u->count;
+        u->cells[u->count] = c;
+        u->count += !bb_test(attempted, c);
+    }
+
+    u->ready = true;
+}
+
+bool untried_contains(const UntriedCells * u, int cell) {
+    return u->pos[cell] < u->count && u->cells[u->pos[cell]] == cell;
+}
+
+void untried_remove(UntriedCells * u, int cell) {
+
+    if ( !untried_contains(u, cell) ) return;
+
+    int last = u->cells[u->count - 1];
+    int hole = u->pos[cell];
+
+    u->cells[hole] = last;
+    u->pos[last] = hole;
+    u->cells[u->count - 1] = cell;
+    u->pos[cell] = u->count - 1;
+    u->count --;
+}
+
+#endif
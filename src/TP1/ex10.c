@@ -1,27 +1,91 @@
 // Suite de Fibonacci
+//
+// usage: ex10             ask for n and print fib(n)
+//        ex10 file        print fib(n) for every n of `file`, one per line
+//
+// fib(0) = fib(1) = 1, so fib(n) is F(n + 1) of fibonacci.h, computed by fast doubling on arbitrary
+// precision integers: fib(10^6) has 208988 digits and takes milliseconds.
 
 #include "hw_printer.h"
+#include "fibonacci.h"
+#include <time.h>
 
-long int compute_fib(long int n) {
+void compute_fib(uint64_t n, BigInt * result, FibCache * cache) {
+    fib(n + 1, result, cache);
+}
+
+void fib_demo() {
+
+    BigInt f = {0};
 
-    if (n == 0 || n == 1) {
-        return 1;
-    } else {
-        return compute_fib(n-1) + compute_fib(n-2);
+    for (int n = 0; n < 10; n ++) {
+
+        compute_fib(n, &f, NULL);
+        printf("fib(%d) = ", n);
+        bigint_print(stdout, &f);
+        printf("\n");
     }
+
+    bigint_free(&f);
 }
 
-void fib_demo() {
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+// Answer every n of `path`, repeated and neighbouring values of n being served from the cache
+int batch(const char * path) {
+
+    FILE * file = fopen(path, "r");
+
+    if (file == NULL) {
+        perror(path);
+        return 2;
+    }
+
+    FibCache * cache = (FibCache *) calloc(1, sizeof(FibCache));
+    BigInt f = {0};
+    unsigned long long n = 0;
+    long count = 0;
+    double start = now_seconds();
 
-    for (int fib = 0; fib < 10; fib ++) {
+    while (fscanf(file, "%llu", &n) == 1) {
 
-        printf("fib(%d) = %ld\n", fib, compute_fib(fib));
+        if (n == UINT64_MAX) {
+            fprintf(stderr, "fib(%llu) is out of range\n", n);
+            continue;
+        }
 
+        compute_fib(n, &f, cache);
+        printf("fib(%llu) = ", n);
+        bigint_print(stdout, &f);
+        printf("\n");
+        count ++;
     }
 
+    int status = 0;
+
+    if (!feof(file)) {
+        fprintf(stderr, "%s: expected one non negative integer per line\n", path);
+        status = 2;
+    }
+
+    fprintf(stderr, "%ld values in %.3f s, %llu from the cache\n", count, now_seconds() - start, (unsigned long long) cache->hits);
+
+    fclose(file);
+    bigint_free(&f);
+    fib_cache_free(cache);
+    free(cache);
+
+    return status;
 }
 
-int main() {
+int main(int argc, char ** argv) {
+
+    if (argc > 1) return batch(argv[1]);
 
     ex(10, "Computer le nieme nombre de Fibonacci");
 
@@ -29,14 +93,23 @@ int main() {
 
     printf("Please enter the nth Fibonacci value that you would like to compute\n");
 
-    scanf("%ld", &n);
-
-    if (n > 40) {
-        printf("Please enter a smaller number\n");
+    if (scanf("%ld", &n) != 1 || n < 0) {
+        printf("Please enter a non negative number\n");
         return 2;
     }
 
-    printf("fib(%ld) = %ld\n", n, compute_fib(n));
+    BigInt f = {0};
+    double start = now_seconds();
+
+    compute_fib(n, &f, NULL);
+
+    double elapsed = now_seconds() - start;
+
+    printf("fib(%ld) = ", n);
+    bigint_print(stdout, &f);
+    printf("\n\n%d digits, computed in %.3f ms\n", bigint_num_digits(&f), elapsed * 1E3);
+
+    bigint_free(&f);
 
     return 0;
 }
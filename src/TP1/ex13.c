@@ -1,38 +1,134 @@
 // Nombres Premiers
+//
+// usage: ex13                                  ask for m and show the primes between 2 and m
+//        ex13 limit [num_threads] [output]     count the primes up to `limit` with the segmented sieve
+//                                              of sieve.h, and write them to `output` ("-" for stdout)
+//        ex13 test file                        print the primes among the 64 bit integers of `file`,
+//                                              tested by is_prime_batch of primality.h
+//        ex13 count x [num_threads]            pi(x) by the Meissel-Lehmer method of prime_count.h,
+//                                              without enumerating the primes
 
 #include "hw_printer.h"
-// #include <stdlib.h>
-#include <math.h>
-#include <stdbool.h>
+#include "sieve.h"
+#include "primality.h"
+#include "prime_count.h"
+#include <time.h>
 
+double now_seconds() {
 
-// int get_rand_int(int max) {
-// // get random integer between 1 and max
-//     double x = ((double) rand()) / RAND_MAX;
-//     return (int) ceil(x * max);
-// }
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+int enumerate(int argc, char ** argv) {
+
+    uint64_t limit = strtoull(argv[1], NULL, 10);
+    int num_threads = argc > 2 ? atoi(argv[2]) : 1;
+    FILE * out = NULL;
+
+    if (num_threads < 1) {
+        fprintf(stderr, "Expected num_threads >= 1\n");
+        return 1;
+    }
+
+    if (argc > 3) {
+
+        out = strcmp(argv[3], "-") == 0 ? stdout : fopen(argv[3], "w");
+
+        if (out == NULL) {
+            perror(argv[3]);
+            return 2;
+        }
+
+        setvbuf(out, NULL, _IOFBF, 1 << 20);
+    }
+
+    double start = now_seconds();
+    uint64_t count = sieve_primes(limit, num_threads, out);
+    double elapsed = now_seconds() - start;
+
+    if (out && out != stdout) fclose(out);
+
+    fprintf(stderr, "%llu primes up to %llu in %.3f s on %d threads\n", (unsigned long long) count,
+            (unsigned long long) limit, elapsed, num_threads);
+
+    return 0;
+}
+
+int test_file(const char * path) {
+
+    FILE * file = fopen(path, "r");
+
+    if (file == NULL) {
+        perror(path);
+        return 2;
+    }
 
-#define MAX 100
+    size_t count = 0, cap = 1024;
+    uint64_t * numbers = (uint64_t *) malloc(sizeof(uint64_t) * cap);
+    unsigned long long x = 0;
 
-bool is_prime(int p) {
+    while (fscanf(file, "%llu", &x) == 1) {
 
-    if( p == 0 || p == 1) {
-        return true;
+        if (count == cap) {
+            cap *= 2;
+            numbers = (uint64_t *) realloc(numbers, sizeof(uint64_t) * cap);
+        }
+
+        numbers[count ++] = x;
     }
 
-    int p_root = ceil(sqrt(p));
+    fclose(file);
+
+    bool * prime = (bool *) malloc(count + 1);
+    size_t num_primes = 0;
+    double start = now_seconds();
 
-    for (int i = 2; i <= p_root; i ++) {
+    is_prime_batch(numbers, prime, count);
 
-        if ( p % i == 0 ) {
-            return false;
+    double elapsed = now_seconds() - start;
+
+    for (size_t k = 0; k < count; k ++) {
+        if (prime[k]) {
+            printf("%llu\n", (unsigned long long) numbers[k]);
+            num_primes ++;
         }
     }
 
-    return true;
+    fprintf(stderr, "%zu primes among %zu numbers, tested in %.3f s (%.1f M/s)\n", num_primes, count, elapsed,
+            elapsed > 0 ? count / elapsed * 1E-6 : 0);
+
+    free(numbers);
+    free(prime);
+
+    return 0;
 }
 
-int main() {
+int count(int argc, char ** argv) {
+
+    uint64_t x = strtoull(argv[2], NULL, 10);
+    int num_threads = argc > 3 ? atoi(argv[3]) : 1;
+
+    if (num_threads < 1) {
+        fprintf(stderr, "Expected num_threads >= 1\n");
+        return 1;
+    }
+
+    double start = now_seconds();
+    uint64_t pi = prime_count(x, num_threads);
+
+    printf("pi(%llu) = %llu\n", (unsigned long long) x, (unsigned long long) pi);
+    fprintf(stderr, "computed in %.3f s on %d threads\n", now_seconds() - start, num_threads);
+
+    return 0;
+}
+
+int main(int argc, char ** argv) {
+
+    if (argc > 2 && strcmp(argv[1], "test") == 0) return test_file(argv[2]);
+    if (argc > 2 && strcmp(argv[1], "count") == 0) return count(argc, argv);
+    if (argc > 1) return enumerate(argc, argv);
 
     ex(13, "Afficher les nombres premiers entre 2 et MAX");
 
@@ -40,12 +136,20 @@ int main() {
 
     printf("Please input a positive integer\n\n");
 
-    scanf("%d", &m);
+    if (scanf("%d", &m) != 1 || m < 2) {
+        printf("There are no primes below 2\n");
+        return 0;
+    }
+
+    uint32_t count = 0;
+    uint32_t * primes = small_primes(m, &count);
+    uint32_t next = 0;
 
     for (int i = 2; i <= m; i++) {
 
-        if ( is_prime(i) ) {
+        if ( next < count && primes[next] == (uint32_t) i ) {
             printf("%d\n", i);
+            next ++;
         } else {
             printf("%d  ", i);
         }
@@ -53,5 +157,7 @@ int main() {
 
     printf("\n\n");
 
+    free(primes);
+
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,147 @@
+// Decomposition en facteurs premiers
+//
+// usage: ex16                          ask for n and print its prime factors
+//        ex16 file [num_threads]       factor every 64 bit integer of `file`, one per line
+//
+// The factorisation is the one of factor.h: trial division by a table of small primes, Miller-Rabin on
+// the cofactor and Pollard-Brent rho to split it. In batch mode, the numbers are read in blocks of
+// FACTOR_BLOCK and the threads take them one at a time, since their cost varies a lot from one number to
+// the next, then the block is printed in the order of the file.
+
+#include "hw_printer.h"
+#include "factor.h"
+#include <pthread.h>
+#include <time.h>
+
+#define FACTOR_BLOCK 65536
+
+typedef struct FactorJob {
+
+    uint64_t * numbers;
+    Factorization * factors;
+    int count;
+    int next;
+
+} FactorJob;
+
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+void print_factorization(FILE * out, uint64_t n, const Factorization * f) {
+
+    fprintf(out, "%llu =", (unsigned long long) n);
+
+    if (f->count == 0) fprintf(out, " %llu", (unsigned long long) n);
+
+    for (int k = 0; k < f->count; k ++) {
+        fprintf(out, k ? " * %llu" : " %llu", (unsigned long long) f->primes[k]);
+        if (f->exponents[k] > 1) fprintf(out, "^%d", f->exponents[k]);
+    }
+
+    fputc('\n', out);
+}
+
+void * factor_thread(void * arg) {
+
+    FactorJob * job = (FactorJob *) arg;
+
+    while (true) {
+
+        int k = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+        if (k >= job->count) break;
+
+        job->factors[k] = factor(job->numbers[k]);
+    }
+
+    return NULL;
+}
+
+int batch(const char * path, int num_threads) {
+
+    FILE * file = fopen(path, "r");
+
+    if (file == NULL) {
+        perror(path);
+        return 2;
+    }
+
+    FactorJob job;
+    job.numbers = (uint64_t *) malloc(sizeof(uint64_t) * FACTOR_BLOCK);
+    job.factors = (Factorization *) malloc(sizeof(Factorization) * FACTOR_BLOCK);
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+    unsigned long long x = 0;
+    long total = 0;
+    double start = now_seconds();
+    bool more = true;
+
+    while (more) {
+
+        job.count = 0;
+        job.next = 0;
+
+        while (job.count < FACTOR_BLOCK && (more = fscanf(file, "%llu", &x) == 1)) {
+            job.numbers[job.count ++] = x;
+        }
+
+        for (int t = 0; t < num_threads; t ++) pthread_create(&threads[t], NULL, factor_thread, &job);
+        for (int t = 0; t < num_threads; t ++) pthread_join(threads[t], NULL);
+
+        for (int k = 0; k < job.count; k ++) print_factorization(stdout, job.numbers[k], &job.factors[k]);
+
+        total += job.count;
+    }
+
+    int status = 0;
+
+    if (!feof(file)) {
+        fprintf(stderr, "%s: expected one non negative integer per line\n", path);
+        status = 2;
+    }
+
+    fprintf(stderr, "%ld numbers factored in %.3f s on %d threads\n", total, now_seconds() - start, num_threads);
+
+    fclose(file);
+    free(job.numbers);
+    free(job.factors);
+    free(threads);
+
+    return status;
+}
+
+int main(int argc, char ** argv) {
+
+    init_factor_table();
+
+    if (argc > 1) {
+
+        int num_threads = argc > 2 ? atoi(argv[2]) : 1;
+
+        if (num_threads < 1) {
+            fprintf(stderr, "Expected num_threads >= 1\n");
+            return 1;
+        }
+
+        return batch(argv[1], num_threads);
+    }
+
+    ex(16, "Decomposer un entier en facteurs premiers");
+
+    unsigned long long n = 0;
+
+    printf("Please enter a positive integer below 2^64\n\n");
+
+    if (scanf("%llu", &n) != 1 || n == 0) {
+        printf("Expected a positive integer\n");
+        return 1;
+    }
+
+    Factorization f = factor(n);
+    print_factorization(stdout, n, &f);
+
+    return 0;
+}
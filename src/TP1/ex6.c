@@ -1,25 +1,7 @@
 #include "hw_printer.h"
+#include "gcd.h"
 #include <stdbool.h>
 
-int PGCD(int a, int b) {
-// Euclid's algorithm to find the greates common divisor
-
-    do {
-        // take the remainder of [bigger number] divided by [smaller number]
-        if (a > b) {
-            a = a % b;
-        } else {
-            b = b % a;
-        }
-    } while(a != 0 && b != 0);
-
-    if (a > b) {
-        return a;
-    } else {
-        return b;
-    }
-}
-
 int main() {
 
     // Lit deux entiers, verifie qu'ils sont bien strictement positifs et affiche leur PGCD
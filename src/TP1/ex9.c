@@ -1,106 +1,222 @@
 // Fractions Egyptiennes
+//
+// usage: ex9                               ask for p/q and print its egyptian decomposition
+//        ex9 N [num_threads] [output]      decompose every irreducible p/q with 0 < p < q <= N, write the
+//                                          decompositions to `output` ("-" for stdout) and print a summary
+//
+// The decomposition is the greedy one of egyptian.h, on arbitrary precision denominators. In batch mode,
+// the denominators q are handed out in blocks of EGYPTIAN_BLOCK, the threads taking them one at a time,
+// then the block is written in the order of q.
 
 #include "hw_printer.h"
-#include <stdlib.h>
+#include "egyptian.h"
+#include <pthread.h>
+#include <time.h>
 
-#define MAX_ITER 10000
+#define EGYPTIAN_BLOCK 256
 
-int PGCD(int a, int b) {
-// Euclid's algorithm to find the greates common divisor
+typedef struct EgyptianStats {
 
-    int r = 0;
+    uint64_t fractions;
+    uint64_t terms;
+    int max_terms;                  // longest decomposition, of max_terms_p / max_terms_q
+    uint64_t max_terms_p, max_terms_q;
+    int max_digits;                 // largest denominator, in the decomposition of max_digits_p / max_digits_q
+    uint64_t max_digits_p, max_digits_q;
 
-    do {
-        if (a > b) {
-            a = a % b;
-            r = a;
-        } else {
-            b = b % a;
-            r = b;
-        }
-    } while(r != 0);
+} EgyptianStats;
+
+typedef struct EgyptianJob {
+
+    uint64_t first;                 // the block is first <= q < first + count
+    int count;
+    int next;
+    bool write;
+    char ** text;                   // text[k] holds the decompositions of q = first + k
+    EgyptianStats * stats;          // one per thread
+
+} EgyptianJob;
+
+typedef struct EgyptianThread {
+
+    EgyptianJob * job;
+    int id;
+
+} EgyptianThread;
 
-    if (a > b) {
-        return a;
-    } else {
-        return b;
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+void print_decomposition(FILE * out, uint64_t n, uint64_t d, const EgyptianFraction * ef) {
+
+    fprintf(out, "%llu/%llu = ", (unsigned long long) n, (unsigned long long) d);
+
+    for (int i = 0; i < ef->length; i ++) {
+        fputs(i ? " + 1/" : "1/", out);
+        bigint_print(out, &ef->den[i]);
     }
+
+    fputc('\n', out);
 }
 
-struct EgyptianFraction {
-// Structure to hold the numerator and denominators of an egyptian fraction
-    int * den;
-    int length;
-};
+void * egyptian_thread(void * arg) {
 
-struct EgyptianFraction egyptian_fraction_decomp(int n, int d) {
+    EgyptianJob * job = ((EgyptianThread *) arg)->job;
+    EgyptianStats * stats = &job->stats[((EgyptianThread *) arg)->id];
+    EgyptianFraction ef = {0};
 
+    while (true) {
 
+        int k = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+        if (k >= job->count) break;
 
-    int i = 2;
+        uint64_t q = job->first + k;
+        FILE * out = NULL;
+        size_t size = 0;
 
-    int temp_n = n;
-    int temp_d = d;
-    int gcd = 0;
-    int i_d = i;
-    int i_n = 1;
-    int num_fractions = 0;
-    int * denominators = malloc(sizeof(n) * 1000);
-    struct EgyptianFraction ef;
+        if (job->write) out = open_memstream(&job->text[k], &size);
 
-    while(i < MAX_ITER && temp_n != 0) {
-        // cross multiply to get temp_n and temp_d that have the same denominator
-        // (temp_n/temp_d) x (1/i)
+        for (uint64_t p = 1; p < q; p ++) {
 
-        i_n = temp_d;
-        i_d = i;
-        temp_n *= i;
-        temp_d *= i;
+            if (gcd_u64(p, q) != 1) continue;
 
-        // printf("i_n = %d  ", i_n);
-        // printf("i = %d, and dealing with temp fraction: %d/%d\n", i, temp_n, temp_d);
+            egyptian_fraction_decomp(p, q, &ef);
 
-        if ( temp_n > i_n ) { // If the remaining fraction is larger than the potential 1/i
+            int digits = bigint_num_digits(&ef.den[ef.length - 1]);
 
-            // printf("%d > %d", temp_n, temp_i);
-            temp_n -= i_n;
+            stats->fractions ++;
+            stats->terms += ef.length;
 
-            // increment the number of fractions, and append to the list
-            denominators[num_fractions] = i;
-            num_fractions ++;
+            if (ef.length > stats->max_terms) {
+                stats->max_terms = ef.length;
+                stats->max_terms_p = p;
+                stats->max_terms_q = q;
+            }
 
-        } else if ( temp_n == i_n ) {
-            denominators[num_fractions] = i;
-            num_fractions ++;
-            // printf("I should be done here wtf\n");
-            break;
+            if (digits > stats->max_digits) {
+                stats->max_digits = digits;
+                stats->max_digits_p = p;
+                stats->max_digits_q = q;
+            }
+
+            if (out) print_decomposition(out, p, q, &ef);
         }
 
-        // reduce the leftover fractions
+        if (out) fclose(out);
+    }
+
+    egyptian_free(&ef);
 
-        gcd = PGCD(temp_n, temp_d);
+    return NULL;
+}
+
+// Add the summary of a thread to `total`, the smallest q winning the ties as with a single thread
+void merge_stats(EgyptianStats * total, const EgyptianStats * s) {
 
-        // printf("gcd(%d, %d) = %d\n", temp_n, temp_d, gcd);
+    total->fractions += s->fractions;
+    total->terms += s->terms;
 
-        temp_n /= gcd;
-        temp_d /= gcd;
+    if (s->max_terms > total->max_terms ||
+        (s->max_terms == total->max_terms && s->max_terms_q < total->max_terms_q)) {
+        total->max_terms = s->max_terms;
+        total->max_terms_p = s->max_terms_p;
+        total->max_terms_q = s->max_terms_q;
+    }
 
-        i++;
+    if (s->max_digits > total->max_digits ||
+        (s->max_digits == total->max_digits && s->max_digits_q < total->max_digits_q)) {
+        total->max_digits = s->max_digits;
+        total->max_digits_p = s->max_digits_p;
+        total->max_digits_q = s->max_digits_q;
     }
+}
+
+int batch(int argc, char ** argv) {
+
+    uint64_t limit = strtoull(argv[1], NULL, 10);
+    int num_threads = argc > 2 ? atoi(argv[2]) : 1;
+    FILE * out = NULL;
 
-    if (i == MAX_ITER) {
-        printf("Something went wrong\n");
+    if (num_threads < 1) {
+        fprintf(stderr, "Expected num_threads >= 1\n");
+        return 1;
     }
 
-    ef.den = denominators;
-    ef.length = num_fractions;
+    if (argc > 3) {
+
+        out = strcmp(argv[3], "-") == 0 ? stdout : fopen(argv[3], "w");
 
-    return ef;
+        if (out == NULL) {
+            perror(argv[3]);
+            return 2;
+        }
 
+        setvbuf(out, NULL, _IOFBF, 1 << 20);
+    }
+
+    EgyptianJob job;
+    job.write = out != NULL;
+    job.text = (char **) calloc(EGYPTIAN_BLOCK, sizeof(char *));
+    job.stats = (EgyptianStats *) calloc(num_threads, sizeof(EgyptianStats));
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+    EgyptianThread * args = (EgyptianThread *) malloc(sizeof(EgyptianThread) * num_threads);
+    double start = now_seconds();
+
+    for (int t = 0; t < num_threads; t ++) args[t] = (EgyptianThread) {&job, t};
+
+    for (uint64_t first = 2; first <= limit; first += EGYPTIAN_BLOCK) {
+
+        job.first = first;
+        job.count = limit - first + 1 < EGYPTIAN_BLOCK ? (int) (limit - first + 1) : EGYPTIAN_BLOCK;
+        job.next = 0;
+
+        for (int t = 0; t < num_threads; t ++) pthread_create(&threads[t], NULL, egyptian_thread, &args[t]);
+        for (int t = 0; t < num_threads; t ++) pthread_join(threads[t], NULL);
+
+        if (out == NULL) continue;
+
+        for (int k = 0; k < job.count; k ++) {
+            fputs(job.text[k], out);
+            free(job.text[k]);
+            job.text[k] = NULL;
+        }
+    }
+
+    double elapsed = now_seconds() - start;
+    EgyptianStats total = {0};
+
+    for (int t = 0; t < num_threads; t ++) merge_stats(&total, &job.stats[t]);
+
+    if (out && out != stdout) fclose(out);
+    else if (out) fflush(out);
+
+    fprintf(stderr, "%llu fractions p/q with q <= %llu, %llu unit fractions, in %.3f s on %d threads\n",
+            (unsigned long long) total.fractions, (unsigned long long) limit, (unsigned long long) total.terms,
+            elapsed, num_threads);
+
+    if (total.fractions) {
+        fprintf(stderr, "longest decomposition: %llu/%llu, %d terms\n", (unsigned long long) total.max_terms_p,
+                (unsigned long long) total.max_terms_q, total.max_terms);
+        fprintf(stderr, "largest denominator: in %llu/%llu, %d digits\n", (unsigned long long) total.max_digits_p,
+                (unsigned long long) total.max_digits_q, total.max_digits);
+    }
+
+    free(job.text);
+    free(job.stats);
+    free(threads);
+    free(args);
+
+    return 0;
 }
 
+int main(int argc, char ** argv) {
 
-int main() {
+    if (argc > 1) return batch(argc, argv);
 
     // get the numerator and denominator
 
@@ -109,16 +225,16 @@ int main() {
     printf("Please input the numerator and denominator of a positive fraction to decompose\n");
     printf("You must follow this format: num/den\n\n");
 
-    int n = 7, d = 8;
+    unsigned long long n = 7, d = 8;
 
-    int scan_out = scanf("%d/%d", &n, &d);
+    int scan_out = scanf("%llu/%llu", &n, &d);
 
     if (scan_out != 2) {
         printf("Program input failed. Exiting with code 1\n");
         return 1;
     }
 
-    if ( n <= 0 || d <= 0) {
+    if ( n == 0 || d == 0) {
         printf("Please input strictly positif integers\n");
         printf("Exiting with error code 2\n");
         return 2;
@@ -130,17 +246,11 @@ int main() {
     }
 
     // solve the egyptian fractions
-    struct EgyptianFraction ef;
-
-    ef = egyptian_fraction_decomp(n, d);
+    EgyptianFraction ef = {0};
 
-    printf("%d/%d = ", n, d);
-
-    for (int i = 0; i < ef.length - 1; i ++) {
-        printf("1/%d + ", ef.den[i]);
-    }
-    printf("1/%d\n", ef.den[ef.length - 1]);
+    egyptian_fraction_decomp(n, d, &ef);
+    print_decomposition(stdout, n, d, &ef);
+    egyptian_free(&ef);
 
     return 0;
 }
-
@@ -13,10 +13,17 @@
 #include <time.h>
 
 
-int main() {
+// usage: ex9 [record_file] [book_file] [rules]
+// When record_file is given, the game is appended to it (see battleship_record.h and replay_stats), "-"
+// to not record it. With book_file, the AI places its fleet from that placement book (see optimize_placement),
+// "-" for none. The rules are "classic" (the default) or "salvo", where each side fires one shot per ship
+// that it still has afloat.
+// Set BATTLESHIP_TIMING to "report" or to a file name to see where the time of the game goes (battleship_timing.h)
+int main(int argc, char ** argv) {
 
     // create board
 
+    timing_init_from_env();
     srand( time (NULL) );
     ejovo_seed();
 
@@ -28,7 +35,6 @@ int main() {
     // TODO Create AI
     // TODO Add pretty introduction
     // TODO Add pretty end
-    // TODO Add salvo game mode
 
 
     // place_carrier(5, 5, 'N', player_station.board);
@@ -46,7 +52,19 @@ int main() {
 
     print_docking_station(&player_station, &enemy_station);
 
-    play_game(&player_station, &enemy_station);
+    const char * record_path = argc > 1 && strcmp(argv[1], "-") != 0 ? argv[1] : NULL;
+    PlacementBook * book = NULL;
+
+    bool salvo = argc > 3 && strcmp(argv[3], "salvo") == 0;
+
+    if (argc > 2 && strcmp(argv[2], "-") != 0 && (book = book_load(argv[2])) == NULL) {
+        printf("Could not load the placement book %s\n", argv[2]);
+        return 1;
+    }
+
+    play_game(&player_station, &enemy_station, record_path, book, salvo);
+
+    book_free(book);
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,53 @@
+// Generate inc/battleship/battleship_masks.h
+//
+// Write the bitboard of every placement (ship length, starting cell, direction) on the 10x10 board
+// as a constant table so that placement tests become a table lookup and an AND.
+//
+// usage: gen_masks > inc/battleship/battleship_masks.h
+
+#include <stdio.h>
+#include "battleship_bitboard.h"
+
+#define MAX_LENGTH 5
+
+const int I_INC[4] = {-1, 0, 1, 0}; // N, E, S, W
+const int J_INC[4] = {0, 1, 0, -1};
+
+int main() {
+
+    printf("#ifndef BATTLESHIP_MASKS\n");
+    printf("#define BATTLESHIP_MASKS\n\n");
+    printf("#include \"battleship_bitboard.h\"\n\n");
+    printf("// GENERATED by src/TP2/ex9/gen_masks.c, do not edit by hand.\n");
+    printf("//\n");
+    printf("// PLACEMENT_MASKS[length][cell][direction] is the mask of a ship of `length` cells whose first cell is\n");
+    printf("// `cell` (= i * 10 + j) and that extends towards DIRECTIONS[direction] ('N', 'E', 'S', 'W'). The mask\n");
+    printf("// is empty when the ship would not fit on the board.\n\n");
+    printf("#define MAX_SHIP_LENGTH %d\n\n", MAX_LENGTH);
+    printf("const Bitboard PLACEMENT_MASKS[MAX_SHIP_LENGTH + 1][BB_CELLS][4] = {\n");
+
+    for (int len = 0; len <= MAX_LENGTH; len ++) {
+
+        printf("    { // length %d\n", len);
+
+        for (int cell = 0; cell < BB_CELLS; cell ++) {
+
+            printf("        {");
+
+            for (int d = 0; d < 4; d ++) {
+
+                Bitboard b = len == 0 ? bb_empty() : bb_line(cell / BB_WIDTH, cell % BB_WIDTH, I_INC[d], J_INC[d], len);
+                printf("{{0x%016llxULL, 0x%09llxULL}}%s", (unsigned long long) b.w[0], (unsigned long long) b.w[1], d < 3 ? ", " : "");
+            }
+
+            printf("},\n");
+        }
+
+        printf("    },\n");
+    }
+
+    printf("};\n\n");
+    printf("#endif\n");
+
+    return 0;
+}
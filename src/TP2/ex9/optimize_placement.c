@@ -0,0 +1,290 @@
+// Recherche de placements difficiles à couler
+//
+// Search for fleets that a targeting strategy needs many shots to sink, and write the best ones to a
+// placement book (battleship_book.h) that the AI can then place its ships from.
+//
+// usage: optimize_placement book_file [strategy] [book_size] [candidates] [rounds] [games] [num_threads] [seed]
+//
+// The number of shots a fleet survives is estimated by self-play: `strategy` fires at the fleet until
+// it is sunk, `games` times. Every fleet is played against the same `games` seeds, so that two fleets are
+// compared on the same games. A deterministic strategy (density) plays the same game against a fleet
+// whatever the seed: its estimate is exact after one game, so `games` is then 1.
+//
+//  1. `candidates` fleets are drawn uniformly and estimated, the best `book_size` are kept.
+//  2. Each of them is improved by hill climbing: for `rounds` rounds a ship is moved to a random legal
+//     placement, and the move is kept if the new fleet survives longer.
+//  3. The book and as many uniformly drawn fleets are estimated again on new seeds, which tells how much
+//     of the gain is real rather than picked from the noise of the search, and the book is written. With
+//     a deterministic strategy there is no noise: the book keeps its estimates and only the uniform fleets
+//     are new.
+//
+// The candidates and the climbs are shared between `num_threads` threads.
+
+#include "battleship_ai.h"
+#include "battleship_book.h"
+#include <pthread.h>
+#include <time.h>
+
+typedef struct Candidate {
+
+    Fleet fleet;
+    double shots;       // mean shots to sink the fleet
+
+} Candidate;
+
+typedef struct Optimizer {
+
+    AIStrategy strategy;
+    int games;
+    int rounds;
+    uint64_t seed;
+    Candidate * candidates;
+    int num_candidates;
+    uint64_t games_seed;    // seeds of the games the candidates are estimated on
+    bool climb;             // climb from every candidate rather than only estimate it
+    int next;               // next candidate to process
+
+} Optimizer;
+
+typedef struct Evaluator {
+
+    DockingStation target;  // the fleet being estimated
+    DockingStation own;     // never fired at
+    XoshiroState rng;
+    MonteCarlo monte_carlo;
+
+} Evaluator;
+
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+// Mean number of shots `o->strategy` needs to sink `fleet`
+double estimate(Optimizer * o, Evaluator * e, const Fleet * fleet) {
+
+    long shots = 0;
+
+    for (int g = 0; g < o->games; g ++) {
+
+        xoshiro_seed(&e->rng, o->games_seed ^ (0x9E3779B97F4A7C15ULL * (g + 1)));
+        reset_docking_station(&e->target);
+        place_fleet(e->target.board, fleet);
+
+        AI ai = {.human_ds = &e->target, .ai_ds = &e->own, .strategy = o->strategy, .rng = &e->rng, .monte_carlo = &e->monte_carlo};
+        ai_reset(&ai);
+
+        int i = 0, j = 0;
+
+        do {
+            shots ++;
+        } while ( !ai_take_shot(&ai, &i, &j).game_over );
+    }
+
+    return (double) shots / o->games;
+}
+
+// Move one ship of `fleet` to another placement that doesn't overlap the rest of the fleet
+void mutate(Fleet * fleet, XoshiroState * rng) {
+
+    int s = xoshiro_unif(rng, 0, NUM_SHIPS - 1);
+    Bitboard others = bb_empty();
+
+    for (int k = 0; k < NUM_SHIPS; k ++) {
+        if (k != s) others = bb_or(others, PLACEMENT_TABLE.placements[fleet->placements[k]].mask);
+    }
+
+    FleetSampler fs;
+    Fleet moved;
+
+    fleet_sampler_init(&fs, others, 1 << s);
+
+    if ( fleet_sampler_draw(&fs, rng, &moved) ) {
+        fleet->placements[s] = moved.placements[s];
+    }
+}
+
+void * optimizer_worker(void * arg) {
+
+    Optimizer * o = (Optimizer *) arg;
+    Evaluator e = {.target = make_new_game(BOARD_SIZE), .own = make_new_game(BOARD_SIZE)};
+
+    monte_carlo_init(&e.monte_carlo, MONTE_CARLO_DEFAULTS);
+
+    while (true) {
+
+        int c = __atomic_fetch_add(&o->next, 1, __ATOMIC_RELAXED);
+        if (c >= o->num_candidates) break;
+
+        Candidate * best = &o->candidates[c];
+        best->shots = estimate(o, &e, &best->fleet);
+
+        if (!o->climb) continue;
+
+        XoshiroState rng;
+        xoshiro_seed(&rng, o->seed ^ (0xD1B54A32D192ED03ULL * (c + 1)));
+
+        for (int r = 0; r < o->rounds; r ++) {
+
+            Candidate next = *best;
+            mutate(&next.fleet, &rng);
+            next.shots = estimate(o, &e, &next.fleet);
+
+            if (next.shots > best->shots) *best = next;
+        }
+    }
+
+    monte_carlo_destroy(&e.monte_carlo);
+    free(e.target.board);
+    free(e.own.board);
+
+    return NULL;
+}
+
+// Estimate (and climb from, if `climb`) every candidate on `num_threads` threads
+void run(Optimizer * o, Candidate * candidates, int n, uint64_t games_seed, bool climb, int num_threads) {
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+
+    o->candidates = candidates;
+    o->num_candidates = n;
+    o->games_seed = games_seed;
+    o->climb = climb;
+    o->next = 0;
+
+    for (int k = 0; k < num_threads; k ++) {
+        pthread_create(&threads[k], NULL, optimizer_worker, o);
+    }
+
+    for (int k = 0; k < num_threads; k ++) {
+        pthread_join(threads[k], NULL);
+    }
+
+    free(threads);
+}
+
+void draw_candidates(Candidate * candidates, int n, XoshiroState * rng) {
+
+    for (int c = 0; c < n; c ++) {
+        fleet_sampler_draw(full_fleet_sampler(), rng, &candidates[c].fleet);
+    }
+}
+
+double mean_shots(const Candidate * candidates, int n) {
+
+    double sum = 0;
+    for (int c = 0; c < n; c ++) sum += candidates[c].shots;
+    return sum / n;
+}
+
+int compare_candidates(const void * a, const void * b) { // most shots first
+
+    double x = ((const Candidate *) a)->shots, y = ((const Candidate *) b)->shots;
+    return (x < y) - (x > y);
+}
+
+int main(int argc, char ** argv) {
+
+    if (argc < 2) {
+        printf("usage: optimize_placement book_file [strategy] [book_size] [candidates] [rounds] [games] [num_threads] [seed]\n");
+        return 1;
+    }
+
+    const char * path = argv[1];
+    Optimizer o = {.strategy = AI_DENSITY, .games = 32, .rounds = 64, .seed = (uint64_t) time(NULL)};
+    int book_size = 64, num_candidates = 2048, num_threads = 4;
+
+    if (argc > 2 && (int) (o.strategy = ai_strategy_from_name(argv[2])) == -1) {
+        printf("Unknown strategy '%s'\n", argv[2]);
+        return 1;
+    }
+
+    if (argc > 3) book_size = atoi(argv[3]);
+    if (argc > 4) num_candidates = atoi(argv[4]);
+    if (argc > 5) o.rounds = atoi(argv[5]);
+    if (argc > 6) o.games = atoi(argv[6]);
+    if (argc > 7) num_threads = atoi(argv[7]);
+    if (argc > 8) o.seed = strtoull(argv[8], NULL, 10);
+
+    if (book_size < 1 || num_candidates < book_size || o.rounds < 0 || o.games < 1 || num_threads < 1) {
+        printf("Expected 1 <= book_size <= candidates, rounds >= 0, games >= 1 and num_threads >= 1\n");
+        return 1;
+    }
+
+    if ( ai_strategy_is_deterministic(o.strategy) && o.games > 1 ) {
+        printf("%s is deterministic, every fleet is estimated on a single game\n", AI_STRATEGY_NAMES[o.strategy]);
+        o.games = 1;
+    }
+
+    printf("Searching %d fleets against %s: %d candidates, %d rounds of climbing, %d games per estimate, %d threads (seed %llu)\n\n",
+           book_size, AI_STRATEGY_NAMES[o.strategy], num_candidates, o.rounds, o.games, num_threads, (unsigned long long) o.seed);
+
+    XoshiroState rng;
+    xoshiro_seed(&rng, o.seed);
+
+    init_placement_table();
+    init_zobrist_keys();
+
+    uint64_t search_seed = xoshiro_next(&rng);
+    uint64_t check_seed = xoshiro_next(&rng);
+
+    // 1. screen uniformly drawn fleets
+    Candidate * candidates = (Candidate *) malloc(sizeof(Candidate) * num_candidates);
+    double start = now_seconds();
+
+    draw_candidates(candidates, num_candidates, &rng);
+    run(&o, candidates, num_candidates, search_seed, false, num_threads);
+    qsort(candidates, num_candidates, sizeof(Candidate), compare_candidates);
+
+    printf("Screening: %.2f shots on average, %.2f for the best %d fleets (%.2f s)\n", mean_shots(candidates, num_candidates),
+           mean_shots(candidates, book_size), book_size, now_seconds() - start);
+
+    // 2. climb from the best ones
+    start = now_seconds();
+
+    run(&o, candidates, book_size, search_seed, true, num_threads);
+    qsort(candidates, book_size, sizeof(Candidate), compare_candidates);
+
+    printf("Climbing:  %.2f shots on average for the book (%.2f s)\n", mean_shots(candidates, book_size), now_seconds() - start);
+
+    BookHeader header = {.magic = BOOK_MAGIC, .num_fleets = (uint32_t) book_size, .strategy = (uint8_t) o.strategy};
+    BookEntry * entries = (BookEntry *) calloc(book_size, sizeof(BookEntry));
+
+    for (int c = 0; c < book_size; c ++) {
+        book_encode_fleet(&candidates[c].fleet, entries[c].fleet);
+        entries[c].mean_shots = (float) candidates[c].shots;
+    }
+
+    // 3. estimate the book and uniform fleets again on games that the search didn't see
+    Candidate * uniform = (Candidate *) malloc(sizeof(Candidate) * book_size);
+
+    draw_candidates(uniform, book_size, &rng);
+    if ( !ai_strategy_is_deterministic(o.strategy) ) run(&o, candidates, book_size, check_seed, false, num_threads);
+    run(&o, uniform, book_size, check_seed, false, num_threads);
+
+    header.book_shots = (float) mean_shots(candidates, book_size);
+    header.random_shots = (float) mean_shots(uniform, book_size);
+
+    if ( ai_strategy_is_deterministic(o.strategy) ) {
+        printf("\n%.2f shots against the book, %.2f against new uniform fleets\n", header.book_shots, header.random_shots);
+    } else {
+        printf("\nOn new games: %.2f shots against the book, %.2f against uniform fleets\n", header.book_shots, header.random_shots);
+    }
+
+    int status = 0;
+
+    if ( book_write(path, &header, entries) ) {
+        printf("Wrote %d fleets to %s\n", book_size, path);
+    } else {
+        perror(path);
+        status = 2;
+    }
+
+    free(candidates);
+    free(uniform);
+    free(entries);
+
+    return status;
+}
@@ -0,0 +1,287 @@
+// Dénombrement des flottes ("perft" de la bataille navale)
+//
+// Count every legal placement of the fleet (SHIP_LENGTHS, in order) on an empty board: each ship lies
+// on the board towards the East or the South and no two ships overlap, exactly what validate_placement
+// accepts once the directions 'N' and 'W' are brought back to 'S' and 'E'. The count for the first
+// `depth` ships is printed for every depth, like the perft of a chess engine, along with the time taken,
+// the number of nodes (partial fleets) visited per second and how the work was shared between threads.
+//
+// usage: perft [num_threads] [max_depth]
+//
+// The classic fleet has 30093975536 legal placements.
+//
+// The search is a backtracking over the precomputed placements of each ship, the board being a single
+// 128 bit mask of the occupied cells. The last ship isn't placed at all: the number of ways to fit it is
+// computed from the free cells with a few shifts and popcounts. The placements of the first ship are
+// handed out to the threads one at a time.
+//
+// Before counting, the placements of the first two ships are also counted with validate_placement and
+// place_ship, and with a plain char grid, which checks the board code against an independent oracle.
+
+#include "battleship_board.h"
+#include "battleship_placements.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+typedef unsigned __int128 Mask;
+
+typedef struct PerftWorker {
+
+    int id;
+    int depth;
+    int roots;          // placements of the first ship that this thread explored
+    uint64_t nodes;     // partial fleets placed
+    uint64_t fleets;
+    double seconds;
+
+} PerftWorker;
+
+Mask PLACEMENT_BITS[MAX_PLACEMENTS];
+Mask BOARD_BITS;                            // the BB_CELLS cells of the board
+Mask EAST_START[MAX_SHIP_LENGTH + 1];       // cells where a ship of a given length can start towards the East
+Mask SOUTH_START[MAX_SHIP_LENGTH + 1];      // and towards the South
+int NEXT_ROOT = 0;
+
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+static inline Mask to_mask(Bitboard b) {
+    return ((Mask) b.w[1] << 64) | b.w[0];
+}
+
+static inline int mask_popcount(Mask m) {
+    return __builtin_popcountll((uint64_t) m) + __builtin_popcountll((uint64_t) (m >> 64));
+}
+
+void init_masks() {
+
+    init_placement_table();
+
+    for (int p = 0; p < PLACEMENT_TABLE.num_placements; p ++) {
+        PLACEMENT_BITS[p] = to_mask(PLACEMENT_TABLE.placements[p].mask);
+    }
+
+    BOARD_BITS = ((Mask) 1 << BB_CELLS) - 1;
+
+    for (int length = 1; length <= MAX_SHIP_LENGTH; length ++) {
+
+        EAST_START[length] = SOUTH_START[length] = 0;
+
+        for (int c = 0; c < BB_CELLS; c ++) {
+            if (c % BOARD_SIZE + length <= BOARD_SIZE) EAST_START[length] |= (Mask) 1 << c;
+            if (c / BOARD_SIZE + length <= BOARD_SIZE) SOUTH_START[length] |= (Mask) 1 << c;
+        }
+    }
+}
+
+// Number of ways to place a ship of `length` on the cells that aren't occupied
+static inline uint64_t count_fits(Mask occupied, int length) {
+
+    Mask free = ~occupied & BOARD_BITS;
+
+    if (length == 1) return mask_popcount(free);
+
+    Mask east = free & EAST_START[length];
+    Mask south = free & SOUTH_START[length];
+
+    for (int n = 1; n < length; n ++) {
+        east &= free >> n;
+        south &= free >> (n * BOARD_SIZE);
+    }
+
+    return mask_popcount(east) + mask_popcount(south);
+}
+
+// Fleets completing `occupied` with the ships [ship, depth)
+uint64_t perft(int ship, int depth, Mask occupied, uint64_t * nodes) {
+
+    if (ship == depth - 1) return count_fits(occupied, SHIP_LENGTHS[ship]);
+
+    PlacementTable * t = &PLACEMENT_TABLE;
+    uint64_t fleets = 0;
+
+    for (int p = t->ship_start[ship]; p < t->ship_start[ship + 1]; p ++) {
+
+        if (PLACEMENT_BITS[p] & occupied) continue;
+
+        (*nodes) ++;
+        fleets += perft(ship + 1, depth, occupied | PLACEMENT_BITS[p], nodes);
+    }
+
+    return fleets;
+}
+
+void * perft_worker(void * arg) {
+
+    PerftWorker * w = (PerftWorker *) arg;
+    PlacementTable * t = &PLACEMENT_TABLE;
+    int num_roots = t->ship_start[1] - t->ship_start[0];
+    double start = now_seconds();
+
+    w->roots = 0;
+    w->nodes = 0;
+    w->fleets = 0;
+
+    while (true) {
+
+        int r = __atomic_fetch_add(&NEXT_ROOT, 1, __ATOMIC_RELAXED);
+        if (r >= num_roots) break;
+
+        int p = t->ship_start[0] + r;
+
+        w->roots ++;
+        w->nodes ++;
+        w->fleets += w->depth == 1 ? 1 : perft(1, w->depth, PLACEMENT_BITS[p], &w->nodes);
+    }
+
+    w->seconds = now_seconds() - start;
+
+    return NULL;
+}
+
+/**========================================================================
+ *                           Oracles
+ *========================================================================**/
+
+// Placements of the first two ships counted with validate_placement and place_ship, every direction
+// included. A placement towards 'N' or 'W' is the same as one towards 'S' or 'E', so each pair of
+// placements is seen 4 times
+uint64_t count_pairs_with_board() {
+
+    const char directions[4] = {'N', 'E', 'S', 'W'};
+    DockingStation ds = make_new_game(BOARD_SIZE);
+    uint64_t pairs = 0;
+
+    for (int c0 = 0; c0 < BB_CELLS; c0 ++) {
+        for (int d0 = 0; d0 < 4; d0 ++) {
+
+            if ( !validate_placement(c0 / BOARD_SIZE, c0 % BOARD_SIZE, directions[d0], ds.board, SHIP_LENGTHS[0]) ) continue;
+
+            place_ship(c0 / BOARD_SIZE, c0 % BOARD_SIZE, directions[d0], ds.board, SHIP_TYPES[0], SHIP_LENGTHS[0]);
+
+            for (int c1 = 0; c1 < BB_CELLS; c1 ++) {
+                for (int d1 = 0; d1 < 4; d1 ++) {
+                    pairs += validate_placement(c1 / BOARD_SIZE, c1 % BOARD_SIZE, directions[d1], ds.board, SHIP_LENGTHS[1]);
+                }
+            }
+
+            clear_board(ds.board);
+        }
+    }
+
+    free(ds.board);
+
+    return pairs / 4;
+}
+
+bool grid_fits(char grid[10][10], int i, int j, int di, int dj, int length) {
+
+    for (int n = 0; n < length; n ++, i += di, j += dj) {
+        if (i >= BOARD_SIZE || j >= BOARD_SIZE || grid[i][j]) return false;
+    }
+
+    return true;
+}
+
+void grid_fill(char grid[10][10], int i, int j, int di, int dj, int length, char value) {
+
+    for (int n = 0; n < length; n ++, i += di, j += dj) {
+        grid[i][j] = value;
+    }
+}
+
+// The same count on a plain grid, without any of the board code
+uint64_t count_pairs_with_grid() {
+
+    char grid[10][10] = {{0}};
+    uint64_t pairs = 0;
+
+    for (int c0 = 0; c0 < 2 * BB_CELLS; c0 ++) {
+
+        int i0 = (c0 >> 1) / BOARD_SIZE, j0 = (c0 >> 1) % BOARD_SIZE, south0 = c0 & 1;
+
+        if ( !grid_fits(grid, i0, j0, south0, !south0, SHIP_LENGTHS[0]) ) continue;
+
+        grid_fill(grid, i0, j0, south0, !south0, SHIP_LENGTHS[0], 1);
+
+        for (int c1 = 0; c1 < 2 * BB_CELLS; c1 ++) {
+            int south1 = c1 & 1;
+            pairs += grid_fits(grid, (c1 >> 1) / BOARD_SIZE, (c1 >> 1) % BOARD_SIZE, south1, !south1, SHIP_LENGTHS[1]);
+        }
+
+        grid_fill(grid, i0, j0, south0, !south0, SHIP_LENGTHS[0], 0);
+    }
+
+    return pairs;
+}
+
+int main(int argc, char ** argv) {
+
+    int num_threads = argc > 1 ? atoi(argv[1]) : 4;
+    int max_depth = argc > 2 ? atoi(argv[2]) : NUM_SHIPS;
+
+    if (num_threads < 1 || max_depth < 1 || max_depth > NUM_SHIPS) {
+        printf("usage: perft [num_threads] [max_depth], with 1 <= max_depth <= %d\n", NUM_SHIPS);
+        return 1;
+    }
+
+    init_masks();
+
+    uint64_t nodes = 0;
+    uint64_t pairs = NUM_SHIPS > 1 ? perft(0, 2, 0, &nodes) : 0;
+    uint64_t board_pairs = count_pairs_with_board();
+    uint64_t grid_pairs = count_pairs_with_grid();
+
+    printf("Placements of the first two ships: %llu (masks), %llu (validate_placement), %llu (grid) %s\n\n",
+           (unsigned long long) pairs, (unsigned long long) board_pairs, (unsigned long long) grid_pairs,
+           pairs == board_pairs && pairs == grid_pairs ? "OK" : "MISMATCH");
+
+    if (pairs != board_pairs || pairs != grid_pairs) return 2;
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+    PerftWorker * workers = (PerftWorker *) malloc(sizeof(PerftWorker) * num_threads);
+
+    for (int depth = 1; depth <= max_depth; depth ++) {
+
+        NEXT_ROOT = 0;
+        double start = now_seconds();
+
+        for (int k = 0; k < num_threads; k ++) {
+            workers[k].id = k;
+            workers[k].depth = depth;
+            pthread_create(&threads[k], NULL, perft_worker, &workers[k]);
+        }
+
+        uint64_t fleets = 0;
+        nodes = 0;
+
+        for (int k = 0; k < num_threads; k ++) {
+            pthread_join(threads[k], NULL);
+            fleets += workers[k].fleets;
+            nodes += workers[k].nodes;
+        }
+
+        double elapsed = now_seconds() - start;
+
+        printf("depth %d: %20llu fleets  %12llu nodes  %9.3f s  %8.2f Mnodes/s  %10.2f Mfleets/s\n", depth,
+               (unsigned long long) fleets, (unsigned long long) nodes, elapsed, nodes / elapsed * 1E-6, fleets / elapsed * 1E-6);
+    }
+
+    printf("\nThreads at depth %d\n", max_depth);
+
+    for (int k = 0; k < num_threads; k ++) {
+        printf("  thread %2d: %4d roots  %12llu nodes  %20llu fleets  %9.3f s\n", workers[k].id, workers[k].roots,
+               (unsigned long long) workers[k].nodes, (unsigned long long) workers[k].fleets, workers[k].seconds);
+    }
+
+    free(threads);
+    free(workers);
+
+    return 0;
+}
@@ -0,0 +1,286 @@
+// Statistiques sur des parties enregistrées
+//
+// Memory map a file of GameRecords (written by `tournament ... record_file` or `ex9 record_file`) and
+// report, for every kind of player: its win rate, the heatmap of the cells it shoots, how many shots it
+// needs to land its first hit and in which order it sinks the enemy ships.
+//
+// usage: replay_stats record_file [game]
+//
+// With a game index, that game is played again from its record instead: every shot is fired on fresh
+// docking stations, checked against the recorded outcome, and the final boards are printed.
+
+#include "battleship_board.h"
+#include "battleship_engine.h"
+#include "battleship_record.h"
+#include "battleship_cli.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define NUM_KINDS (NUM_AI_STRATEGIES + 1) // every strategy, then the human player
+
+typedef struct KindStats {
+
+    long games;
+    long wins;
+    long shots;                             // shots fired in all of the games
+    long cell_shots[BB_CELLS];
+    long cell_hits[BB_CELLS];
+    long first_hit[BB_CELLS + 1];           // histogram of the number of shots up to the first hit
+    long sink_order[5][5];           // [ship][k]: games where `ship` was the k-th ship sunk
+
+} KindStats;
+
+const char * kind_name(int kind) {
+    return kind == NUM_AI_STRATEGIES ? "human" : AI_STRATEGY_NAMES[kind];
+}
+
+int player_kind(uint8_t player) {
+    return player < NUM_AI_STRATEGIES ? player : NUM_AI_STRATEGIES;
+}
+
+// Add a game to the statistics of its two players, the record having passed record_is_valid
+void accumulate(KindStats * stats, const GameRecord * record) {
+
+    int kinds[2] = {player_kind(record->players[0]), player_kind(record->players[1])};
+    int shots[2] = {0, 0};
+    int sunk[2] = {0, 0};
+    bool hit[2] = {false, false};
+
+    for (int side = 0; side < 2; side ++) {
+        stats[kinds[side]].games ++;
+        if (record->winner == side) stats[kinds[side]].wins ++;
+    }
+
+    for (int n = 0; n < record->num_shots; n ++) {
+
+        uint16_t shot = record->shots[n];
+        int side = record_shot_side(shot);
+        int cell = record_shot_cell(shot);
+        ShotOutcome outcome = record_shot_outcome(shot);
+        KindStats * s = &stats[kinds[side]];
+
+        shots[side] ++;
+        s->shots ++;
+        s->cell_shots[cell] ++;
+
+        if (outcome == SHOT_MISS) continue;
+
+        s->cell_hits[cell] ++;
+
+        if (!hit[side]) {
+            s->first_hit[shots[side]] ++;
+            hit[side] = true;
+        }
+
+        if (outcome == SHOT_SUNK && sunk[side] < NUM_SHIPS) {
+            s->sink_order[record_shot_ship(shot)][sunk[side] ++] ++;
+        }
+    }
+}
+
+// value below which a fraction p of a histogram lies
+int histogram_percentile(const long * histogram, int n, double p) {
+
+    long total = 0, seen = 0;
+
+    for (int k = 0; k < n; k ++) total += histogram[k];
+
+    for (int k = 0; k < n; k ++) {
+        seen += histogram[k];
+        if (seen > 0 && seen >= p * total) return k;
+    }
+
+    return 0;
+}
+
+void print_heatmap(const long * values, const long * totals, double scale) {
+
+    printf("     ");
+    for (int j = 0; j < BOARD_SIZE; j ++) printf("%5d", NUMBERS[j]);
+    printf("\n");
+
+    for (int i = 0; i < BOARD_SIZE; i ++) {
+
+        printf("  %c  ", LETTERS[i]);
+
+        for (int j = 0; j < BOARD_SIZE; j ++) {
+            int c = i * BOARD_SIZE + j;
+            long total = totals ? totals[c] : 1;
+            printf("%5.1f", total ? scale * values[c] / total : 0.0);
+        }
+
+        printf("\n");
+    }
+}
+
+void print_stats(const KindStats * s, int kind) {
+
+    printf("=== %s: %ld games, %.2f%% won, %.2f shots per game\n\n", kind_name(kind), s->games,
+           100.0 * s->wins / s->games, (double) s->shots / s->games);
+
+    long hits = 0, total = 0;
+
+    for (int k = 0; k <= BB_CELLS; k ++) {
+        hits += s->first_hit[k];
+        total += k * s->first_hit[k];
+    }
+
+    if (hits) {
+        printf("First hit after %.2f shots on average, p50 %d, p99 %d\n\n", (double) total / hits,
+               histogram_percentile(s->first_hit, BB_CELLS + 1, 0.5), histogram_percentile(s->first_hit, BB_CELLS + 1, 0.99));
+    }
+
+    printf("Percentage of the games where each cell was shot\n");
+    print_heatmap(s->cell_shots, NULL, 100.0 / s->games);
+
+    printf("\nPercentage of the shots on each cell that hit\n");
+    print_heatmap(s->cell_hits, s->cell_shots, 100.0);
+
+    printf("\nSink order (percentage of the games where the ship was the k-th one sunk)\n");
+    printf("              ");
+    for (int k = 0; k < NUM_SHIPS; k ++) printf("%7d", k + 1);
+    printf("\n");
+
+    for (int ship = 0; ship < NUM_SHIPS; ship ++) {
+        printf("  %-12s", SHIP_NAMES[ship]);
+        for (int k = 0; k < NUM_SHIPS; k ++) printf("%7.1f", 100.0 * s->sink_order[ship][k] / s->games);
+        printf("\n");
+    }
+
+    printf("\n");
+}
+
+// Play a recorded game again and check every outcome, returns the number of mismatches
+int replay(const GameRecord * record) {
+
+    DockingStation ds[2] = {make_new_game(BOARD_SIZE), make_new_game(BOARD_SIZE)};
+    int mismatches = 0;
+
+    for (int side = 0; side < 2; side ++) {
+        if ( !record_replay_fleet(record, side, &ds[side]) ) {
+            printf("The fleet of side %d is not a legal fleet\n", side);
+            mismatches ++;
+        }
+    }
+
+    printf("Seed %llu, %s vs %s, %d shots, first player: %d\n\n", (unsigned long long) record->seed,
+           kind_name(player_kind(record->players[0])), kind_name(player_kind(record->players[1])),
+           record->num_shots, record->first_player);
+
+    for (int n = 0; n < record->num_shots; n ++) {
+
+        uint16_t shot = record->shots[n];
+        int side = record_shot_side(shot);
+        int cell = record_shot_cell(shot);
+
+        ShotResult result = fire(&ds[1 - side], cell / BOARD_SIZE, cell % BOARD_SIZE);
+
+        printf("%3d  side %d  %c%-2d  %s", n + 1, side, LETTERS[cell / BOARD_SIZE], cell % BOARD_SIZE + 1,
+               result.outcome == SHOT_MISS ? "miss" : result.outcome == SHOT_INVALID ? "invalid" : SHIP_NAMES[result.ship]);
+        printf("%s", result.outcome == SHOT_SUNK ? " sunk" : "");
+
+        if (result.outcome != record_shot_outcome(shot) ||
+            (result.outcome >= SHOT_HIT && result.ship != record_shot_ship(shot))) {
+            printf("  <- recorded differently");
+            mismatches ++;
+        }
+
+        printf("\n");
+    }
+
+    printf("\nSide 0 on the left, what side 0 knows of side 1 on the right\n\n");
+    print_docking_station(&ds[0], &ds[1]);
+
+    if (record->winner == RECORD_NO_WINNER) printf("Unfinished game\n");
+    else printf("Side %d won\n", record->winner);
+
+    free(ds[0].board);
+    free(ds[1].board);
+
+    return mismatches;
+}
+
+int main(int argc, char ** argv) {
+
+    if (argc < 2) {
+        printf("usage: replay_stats record_file [game]\n");
+        return 1;
+    }
+
+    int fd = open(argv[1], O_RDONLY);
+    struct stat st;
+
+    if (fd == -1 || fstat(fd, &st) == -1) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    size_t num_records = st.st_size / sizeof(GameRecord);
+
+    if (num_records == 0) {
+        printf("%s doesn't contain any record\n", argv[1]);
+        return 1;
+    }
+
+    if (st.st_size % sizeof(GameRecord)) {
+        printf("Ignoring %zu trailing bytes\n", (size_t) (st.st_size % sizeof(GameRecord)));
+    }
+
+    const GameRecord * records = (const GameRecord *) mmap(NULL, num_records * sizeof(GameRecord), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (records == MAP_FAILED) {
+        perror("mmap");
+        return 1;
+    }
+
+    int status = 0;
+
+    if (argc > 2) {
+
+        long game = atol(argv[2]);
+
+        if (game < 0 || (size_t) game >= num_records || records[game].magic != RECORD_MAGIC) {
+            printf("There is no game %ld in %s (%zu records)\n", game, argv[1], num_records);
+            status = 1;
+        } else if ( !record_is_valid(&records[game]) ) {
+            printf("Game %ld of %s is corrupted\n", game, argv[1]);
+            status = 2;
+        } else {
+            status = replay(&records[game]) ? 2 : 0;
+        }
+
+    } else {
+
+        madvise((void *) records, num_records * sizeof(GameRecord), MADV_SEQUENTIAL);
+
+        KindStats * stats = (KindStats *) calloc(NUM_KINDS, sizeof(KindStats));
+        size_t corrupted = 0;
+
+        for (size_t r = 0; r < num_records; r ++) {
+
+            if ( !record_is_valid(&records[r]) ) {
+                corrupted ++;
+                continue;
+            }
+
+            accumulate(stats, &records[r]);
+        }
+
+        printf("%zu games in %s", num_records - corrupted, argv[1]);
+        if (corrupted) printf(" (%zu corrupted records skipped)", corrupted);
+        printf("\n\n");
+
+        for (int kind = 0; kind < NUM_KINDS; kind ++) {
+            if (stats[kind].games) print_stats(&stats[kind], kind);
+        }
+
+        free(stats);
+    }
+
+    munmap((void *) records, num_records * sizeof(GameRecord));
+
+    return status;
+}
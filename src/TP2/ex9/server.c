@@ -0,0 +1,584 @@
+// Serveur de bataille navale
+//
+// Host games between clients and the AI on a single thread. Clients connect to a Unix domain socket and
+// speak the fixed size protocol of battleship_protocol.h: they open games, place their fleet and fire,
+// and the AI of each game fires back in the response. Every connection may run any number of games and
+// pipeline any number of requests; all of them are served by one epoll event loop, a game being nothing
+// more than a pair of DockingStations and an AI kept on the heap between two requests.
+//
+// usage: server [socket_path] [seed] [report_seconds] [max_games]
+//
+// Every `report_seconds` the server prints the request rate and the latency percentiles of the last
+// period, and on SIGINT or SIGTERM the percentiles of the whole run for each kind of request. The latency
+// of a request is measured from the read that delivered it to the moment its response is ready to be sent.
+//
+// AI_MONTE_CARLO opponents are refused: each of their decisions spends its whole time budget, during
+// which every other game of the server would wait.
+
+#define _GNU_SOURCE // accept4
+
+#include "battleship_ai.h"
+#include "battleship_latency.h"
+#include "battleship_protocol.h"
+#include <errno.h>
+#include <signal.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#define MAX_EVENTS 256
+#define IN_BUFFER (1024 * sizeof(ServerRequest))
+#define OUT_LIMIT (1 << 20)         // stop reading from a client that has that many bytes of responses pending
+#define READS_PER_EVENT 16          // then let the other connections have their turn
+#define GAME_SLOT_BITS 20           // a game id is its slot in the lower bits and the number of times the slot was used above
+#define MAX_GAMES (1 << GAME_SLOT_BITS)
+#define WHOLE_FLEET ALL_SHIPS_SUNK      // `placed` once every ship is on the board
+
+struct Connection;
+
+typedef struct ServerGame {
+
+    DockingStation ds[2];           // ds[0] holds the fleet of the client, ds[1] the fleet of the AI
+    AI ai;
+    XoshiroState rng;
+    uint32_t id;
+    uint8_t placed;                 // ships of the client that are on the board
+    struct Connection * owner;      // NULL when the slot is free
+    struct ServerGame * prev;       // games of the same connection
+    struct ServerGame * next;
+
+} ServerGame;
+
+typedef struct Connection {
+
+    int fd;
+    uint8_t in[IN_BUFFER];
+    size_t in_len;
+    uint8_t * out;
+    size_t out_len;
+    size_t out_sent;
+    size_t out_cap;
+    bool reading;                   // EPOLLIN is part of the events we wait for
+    bool writing;                   // and EPOLLOUT
+    ServerGame * games;
+
+} Connection;
+
+typedef struct Server {
+
+    int listen_fd;
+    int epoll_fd;
+    uint64_t seed;
+    ServerGame ** games;            // slots, allocated the first time they are used and then kept
+    int num_slots;
+    int max_games;
+    int * free_slots;
+    int num_free;
+    int active_games;
+    int connections;
+    uint64_t games_started;
+    LatencyHistogram period;        // every request since the last report
+    LatencyHistogram latency[REQUEST_END + 1]; // every request of the run, by type
+
+} Server;
+
+volatile sig_atomic_t STOP = 0;
+
+void on_signal(int sig) {
+    (void) sig;
+    STOP = 1;
+}
+
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+/**========================================================================
+ *                           Games
+ *========================================================================**/
+
+ServerGame * find_game(Server * s, Connection * c, uint32_t id) {
+
+    uint32_t slot = id & (MAX_GAMES - 1);
+
+    if (slot >= (uint32_t) s->num_slots) return NULL;
+
+    ServerGame * g = s->games[slot];
+
+    return g->owner == c && g->id == id ? g : NULL;
+}
+
+// Returns NULL, with the reason in `status`, when the game can't be opened
+ServerGame * start_game(Server * s, Connection * c, AIStrategy strategy, ResponseStatus * status) {
+
+    ServerGame * g = NULL;
+    int slot;
+
+    if (s->num_free > 0) {
+
+        slot = s->free_slots[-- s->num_free];
+        g = s->games[slot];
+        reset_docking_station(&g->ds[0]);
+        reset_docking_station(&g->ds[1]);
+        g->id += MAX_GAMES;
+
+    } else if (s->num_slots < s->max_games) {
+
+        slot = s->num_slots ++;
+        g = s->games[slot] = (ServerGame *) malloc(sizeof(ServerGame));
+        g->ds[0] = make_new_game(BOARD_SIZE);
+        g->ds[1] = make_new_game(BOARD_SIZE);
+        g->id = slot;
+
+    } else {
+        *status = STATUS_FULL;
+        return NULL;
+    }
+
+    xoshiro_seed(&g->rng, s->seed ^ (0x9E3779B97F4A7C15ULL * ++ s->games_started));
+
+    g->ai = (AI) {.human_ds = &g->ds[0], .ai_ds = &g->ds[1], .strategy = strategy, .rng = &g->rng};
+    ai_reset(&g->ai);
+
+    if ( !ai_place_ships(&g->ai) ) {
+        g->owner = NULL;
+        s->free_slots[s->num_free ++] = slot;
+        *status = STATUS_NO_FLEET;
+        return NULL;
+    }
+
+    g->placed = 0;
+    g->owner = c;
+    g->prev = NULL;
+    g->next = c->games;
+    if (c->games) c->games->prev = g;
+    c->games = g;
+
+    s->active_games ++;
+
+    return g;
+}
+
+void end_game(Server * s, ServerGame * g) {
+
+    Connection * c = g->owner;
+
+    if (g->prev) g->prev->next = g->next;
+    else c->games = g->next;
+    if (g->next) g->next->prev = g->prev;
+
+    g->owner = NULL;
+    s->free_slots[s->num_free ++] = g->id & (MAX_GAMES - 1);
+    s->active_games --;
+}
+
+void place_random(ServerGame * g) {
+
+    FleetSampler fs;
+    Fleet fleet;
+    uint8_t missing = WHOLE_FLEET & ~g->placed;
+
+    fleet_sampler_init(&fs, g->ds[0].board->occupied, missing);
+
+    if ( fleet_sampler_draw(&fs, &g->rng, &fleet) ) {
+        place_fleet(g->ds[0].board, &fleet);
+        g->placed |= missing;
+    }
+}
+
+ServerResponse handle_request(Server * s, Connection * c, const ServerRequest * req) {
+
+    ServerResponse res = {STATUS_OK, SHOT_INVALID, NO_SHIP, WINNER_NONE, NO_CELL, SHOT_INVALID, NO_SHIP, 0, req->game};
+    ServerGame * g = NULL;
+
+    if (req->type == REQUEST_NEW_GAME) {
+
+        if (req->arg >= NUM_AI_STRATEGIES || req->arg == AI_MONTE_CARLO) {
+            res.status = STATUS_BAD_REQUEST;
+        } else {
+
+            ResponseStatus status = STATUS_OK;
+
+            if ( (g = start_game(s, c, (AIStrategy) req->arg, &status)) == NULL ) res.status = status;
+            else res.game = g->id;
+        }
+
+        return res;
+    }
+
+    if (req->type < REQUEST_NEW_GAME || req->type > REQUEST_END) {
+        res.status = STATUS_BAD_REQUEST;
+        return res;
+    }
+
+    if ( (g = find_game(s, c, req->game)) == NULL ) {
+        res.status = STATUS_NO_SUCH_GAME;
+        return res;
+    }
+
+    switch (req->type) {
+
+    case REQUEST_PLACE:
+
+        if (req->ship >= NUM_SHIPS || req->cell >= BB_CELLS) {
+            res.status = STATUS_BAD_REQUEST;
+        } else if ( ((g->placed >> req->ship) & 1) ||
+                    !deploy_ship(&g->ds[0], req->cell / BOARD_SIZE, req->cell % BOARD_SIZE, req->arg, req->ship) ) {
+            res.status = STATUS_BAD_PLACEMENT;
+        } else {
+            g->placed |= 1 << req->ship;
+        }
+        break;
+
+    case REQUEST_PLACE_RANDOM:
+
+        place_random(g);
+        if (g->placed != WHOLE_FLEET) res.status = STATUS_BAD_PLACEMENT;
+        break;
+
+    case REQUEST_SHOT: {
+
+        if (g->placed != WHOLE_FLEET) {
+            res.status = STATUS_NOT_READY;
+            break;
+        }
+
+        ShotResult result = req->cell < BB_CELLS ? fire(&g->ds[1], req->cell / BOARD_SIZE, req->cell % BOARD_SIZE) : (ShotResult) {SHOT_INVALID, -1, false};
+
+        if (result.outcome == SHOT_INVALID) {
+            res.status = STATUS_INVALID_SHOT;
+            break;
+        }
+
+        res.outcome = result.outcome;
+        res.ship = encode_ship(result.ship);
+
+        if (result.game_over) {
+            res.winner = WINNER_CLIENT;
+            end_game(s, g);
+            break;
+        }
+
+        int i = 0, j = 0;
+        ShotResult reply = ai_take_shot(&g->ai, &i, &j);
+
+        res.reply_cell = i * BOARD_SIZE + j;
+        res.reply_outcome = reply.outcome;
+        res.reply_ship = encode_ship(reply.ship);
+
+        if (reply.game_over) {
+            res.winner = WINNER_SERVER;
+            end_game(s, g);
+        }
+        break;
+    }
+
+    case REQUEST_END:
+        end_game(s, g);
+        break;
+    }
+
+    return res;
+}
+
+/**========================================================================
+ *                           Connections
+ *========================================================================**/
+
+void watch(Server * s, Connection * c, bool reading, bool writing) {
+
+    if (c->reading == reading && c->writing == writing) return;
+
+    struct epoll_event ev = {.events = (reading ? EPOLLIN : 0) | (writing ? EPOLLOUT : 0), .data.ptr = c};
+
+    epoll_ctl(s->epoll_fd, EPOLL_CTL_MOD, c->fd, &ev);
+    c->reading = reading;
+    c->writing = writing;
+}
+
+void close_connection(Server * s, Connection * c) {
+
+    while (c->games) {
+        end_game(s, c->games);
+    }
+
+    epoll_ctl(s->epoll_fd, EPOLL_CTL_DEL, c->fd, NULL);
+    close(c->fd);
+    free(c->out);
+    free(c);
+
+    s->connections --;
+}
+
+void accept_connections(Server * s) {
+
+    while (true) {
+
+        int fd = accept4(s->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+        if (fd == -1) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) perror("accept");
+            return;
+        }
+
+        Connection * c = (Connection *) calloc(1, sizeof(Connection));
+        c->fd = fd;
+        c->reading = true;
+
+        struct epoll_event ev = {.events = EPOLLIN, .data.ptr = c};
+
+        if (epoll_ctl(s->epoll_fd, EPOLL_CTL_ADD, fd, &ev) == -1) {
+            perror("epoll_ctl");
+            close(fd);
+            free(c);
+            continue;
+        }
+
+        s->connections ++;
+    }
+}
+
+// Send what we can of the pending responses. Returns false if the connection broke
+bool flush_connection(Server * s, Connection * c) {
+
+    while (c->out_sent < c->out_len) {
+
+        ssize_t n = send(c->fd, c->out + c->out_sent, c->out_len - c->out_sent, MSG_NOSIGNAL);
+
+        if (n == -1) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+
+        c->out_sent += n;
+    }
+
+    if (c->out_sent == c->out_len) {
+        c->out_sent = c->out_len = 0;
+    }
+
+    size_t pending = c->out_len - c->out_sent;
+
+    watch(s, c, pending < OUT_LIMIT, pending > 0);
+
+    return true;
+}
+
+void queue_response(Connection * c, const ServerResponse * res) {
+
+    if (c->out_len + sizeof(ServerResponse) > c->out_cap) {
+
+        if (c->out_sent > 0) { // make room at the front first
+            memmove(c->out, c->out + c->out_sent, c->out_len - c->out_sent);
+            c->out_len -= c->out_sent;
+            c->out_sent = 0;
+        }
+
+        if (c->out_len + sizeof(ServerResponse) > c->out_cap) {
+            c->out_cap = c->out_cap ? 2 * c->out_cap : 64 * sizeof(ServerResponse);
+            c->out = (uint8_t *) realloc(c->out, c->out_cap);
+        }
+    }
+
+    memcpy(c->out + c->out_len, res, sizeof(ServerResponse));
+    c->out_len += sizeof(ServerResponse);
+}
+
+// Read and serve the requests of a client. Returns false if the connection is closed
+bool serve_connection(Server * s, Connection * c) {
+
+    for (int r = 0; r < READS_PER_EVENT && c->out_len - c->out_sent < OUT_LIMIT; r ++) {
+
+        size_t space = IN_BUFFER - c->in_len;
+        ssize_t n = read(c->fd, c->in + c->in_len, space);
+
+        if (n == 0) return false;
+
+        if (n == -1) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN || errno == EWOULDBLOCK) break;
+            return false;
+        }
+
+        uint64_t start = latency_now_ns();
+        size_t num_requests = (c->in_len + n) / sizeof(ServerRequest);
+
+        c->in_len += n;
+
+        for (size_t k = 0; k < num_requests; k ++) {
+
+            ServerRequest req;
+            memcpy(&req, c->in + k * sizeof(ServerRequest), sizeof(ServerRequest));
+
+            ServerResponse res = handle_request(s, c, &req);
+            queue_response(c, &res);
+
+            uint64_t elapsed = latency_now_ns() - start;
+            latency_record(&s->period, elapsed);
+            latency_record(&s->latency[req.type <= REQUEST_END ? req.type : 0], elapsed);
+        }
+
+        // keep the start of a request that was cut in two
+        c->in_len -= num_requests * sizeof(ServerRequest);
+        memmove(c->in, c->in + num_requests * sizeof(ServerRequest), c->in_len);
+
+        if ((size_t) n < space) break; // the socket is drained
+    }
+
+    return flush_connection(s, c);
+}
+
+/**========================================================================
+ *                           Main loop
+ *========================================================================**/
+
+int open_socket(const char * path) {
+
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        printf("Socket path too long: %s\n", path);
+        return -1;
+    }
+
+    strcpy(addr.sun_path, path);
+    unlink(path);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+
+    if (fd == -1 || bind(fd, (struct sockaddr *) &addr, sizeof(addr)) == -1 || listen(fd, SOMAXCONN) == -1) {
+        perror(path);
+        if (fd != -1) close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+void report(Server * s, double elapsed) {
+
+    printf("%5d connections  %7d games  %10.0f requests/s\n", s->connections, s->active_games, s->period.total / elapsed);
+    latency_print("  latency", &s->period);
+    fflush(stdout);
+
+    latency_reset(&s->period);
+}
+
+int main(int argc, char ** argv) {
+
+    const char * path = argc > 1 ? argv[1] : "/tmp/battleship.sock";
+    Server s = {.seed = argc > 2 ? strtoull(argv[2], NULL, 10) : (uint64_t) time(NULL)};
+    double report_seconds = argc > 3 ? atof(argv[3]) : 5;
+
+    s.max_games = argc > 4 ? atoi(argv[4]) : MAX_GAMES;
+
+    if (s.max_games < 1 || s.max_games > MAX_GAMES) {
+        printf("max_games must be between 1 and %d\n", MAX_GAMES);
+        return 1;
+    }
+
+    if ( (s.listen_fd = open_socket(path)) == -1 ) return 1;
+
+    s.epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    s.games = (ServerGame **) malloc(sizeof(ServerGame *) * s.max_games);
+    s.free_slots = (int *) malloc(sizeof(int) * s.max_games);
+
+    struct epoll_event ev = {.events = EPOLLIN, .data.ptr = NULL};
+    epoll_ctl(s.epoll_fd, EPOLL_CTL_ADD, s.listen_fd, &ev);
+
+    struct sigaction sa = {.sa_handler = on_signal};
+    sigaction(SIGINT, &sa, NULL);
+    sigaction(SIGTERM, &sa, NULL);
+
+    init_placement_table();
+    init_zobrist_keys();
+
+    printf("Listening on %s (seed %llu)\n", path, (unsigned long long) s.seed);
+    fflush(stdout);
+
+    struct epoll_event events[MAX_EVENTS];
+    double start = now_seconds();
+    double last_report = start;
+
+    while (!STOP) {
+
+        int timeout = -1;
+
+        if (report_seconds > 0) { // wake up for the next report
+            timeout = (int) ((last_report + report_seconds - now_seconds()) * 1000);
+            if (timeout < 0) timeout = 0;
+        }
+
+        int n = epoll_wait(s.epoll_fd, events, MAX_EVENTS, timeout);
+
+        if (n == -1 && errno != EINTR) {
+            perror("epoll_wait");
+            break;
+        }
+
+        for (int k = 0; k < n; k ++) {
+
+            Connection * c = (Connection *) events[k].data.ptr;
+
+            if (c == NULL) {
+                accept_connections(&s);
+                continue;
+            }
+
+            bool open = true;
+
+            if (events[k].events & EPOLLIN) open = serve_connection(&s, c);
+            else if (events[k].events & EPOLLOUT) open = flush_connection(&s, c);
+            else if (events[k].events & (EPOLLHUP | EPOLLERR)) open = false;
+
+            if (!open) close_connection(&s, c);
+        }
+
+        double now = now_seconds();
+
+        if (report_seconds > 0 && now - last_report >= report_seconds) {
+            report(&s, now - last_report);
+            last_report = now;
+        }
+    }
+
+    LatencyHistogram all;
+    latency_reset(&all);
+
+    for (int t = REQUEST_NEW_GAME; t <= REQUEST_END; t ++) {
+        latency_merge(&all, &s.latency[t]);
+    }
+
+    const char * names[REQUEST_END + 1] = {"unknown", "new game", "place", "place random", "shot", "end"};
+
+    printf("\n%llu games started, %llu requests in %.3f s\n", (unsigned long long) s.games_started,
+           (unsigned long long) (all.total + s.latency[0].total), now_seconds() - start);
+
+    for (int t = 0; t <= REQUEST_END; t ++) {
+        if (s.latency[t].total) latency_print(names[t], &s.latency[t]);
+    }
+
+    latency_print("all", &all);
+
+    close(s.listen_fd);
+    close(s.epoll_fd);
+    unlink(path);
+
+    for (int k = 0; k < s.num_slots; k ++) {
+        free(s.games[k]->ds[0].board);
+        free(s.games[k]->ds[1].board);
+        free(s.games[k]);
+    }
+
+    free(s.games);
+    free(s.free_slots);
+
+    return 0;
+}
@@ -0,0 +1,298 @@
+// Charge pour le serveur de bataille navale
+//
+// Play games against a running server (server.c) as fast as it answers, and report the request rate and
+// the round trip latency of the requests.
+//
+// usage: server_bench [socket_path] [num_threads] [games_in_flight] [num_games] [strategy]
+//
+// Each thread opens one connection and keeps `games_in_flight` games going on it. In every round it sends
+// one request for each of its games (a new game, the placement of the fleet or the next shot) in a single
+// write, then reads all of the responses back: the latency of a request is the round trip of its round.
+// The client fires at the cells of the board in a random order, `strategy` is played by the server.
+
+#include "battleship_latency.h"
+#include "battleship_protocol.h"
+#include "battleship_rng.h"
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+const char * STRATEGY_NAMES[] = {"random", "density"}; // the strategies the server accepts, by AIStrategy
+
+typedef enum ClientState {
+
+    CLIENT_IDLE,        // no game, a new one is requested
+    CLIENT_STARTED,     // the fleet is placed next
+    CLIENT_PLAYING,
+
+} ClientState;
+
+typedef struct ClientGame {
+
+    ClientState state;
+    uint32_t id;
+    uint8_t order[BB_CELLS];    // cells in the order they are fired at
+    int next;
+
+} ClientGame;
+
+typedef struct BenchThread {
+
+    const char * path;
+    int id;
+    int in_flight;
+    int num_games;              // games this thread plays
+    uint8_t strategy;
+    int games_won;
+    int games_lost;
+    long errors;
+    LatencyHistogram latency;
+
+} BenchThread;
+
+int connect_to(const char * path) {
+
+    struct sockaddr_un addr = {.sun_family = AF_UNIX};
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+    strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+
+    if (fd == -1 || connect(fd, (struct sockaddr *) &addr, sizeof(addr)) == -1) {
+        perror(path);
+        if (fd != -1) close(fd);
+        return -1;
+    }
+
+    return fd;
+}
+
+bool write_all(int fd, const void * data, size_t n) {
+
+    const uint8_t * p = (const uint8_t *) data;
+
+    while (n > 0) {
+
+        ssize_t w = write(fd, p, n);
+
+        if (w == -1 && errno == EINTR) continue;
+        if (w <= 0) return false;
+
+        p += w;
+        n -= w;
+    }
+
+    return true;
+}
+
+bool read_all(int fd, void * data, size_t n) {
+
+    uint8_t * p = (uint8_t *) data;
+
+    while (n > 0) {
+
+        ssize_t r = read(fd, p, n);
+
+        if (r == -1 && errno == EINTR) continue;
+        if (r <= 0) return false;
+
+        p += r;
+        n -= r;
+    }
+
+    return true;
+}
+
+void shuffle_cells(ClientGame * g, XoshiroState * rng) {
+
+    for (int c = 0; c < BB_CELLS; c ++) {
+        g->order[c] = c;
+    }
+
+    for (int c = BB_CELLS - 1; c > 0; c --) {
+        int k = xoshiro_below(rng, c + 1);
+        uint8_t tmp = g->order[c];
+        g->order[c] = g->order[k];
+        g->order[k] = tmp;
+    }
+
+    g->next = 0;
+}
+
+void * bench_thread(void * arg) {
+
+    BenchThread * b = (BenchThread *) arg;
+    int fd = connect_to(b->path);
+
+    if (fd == -1) {
+        b->errors ++;
+        return NULL;
+    }
+
+    XoshiroState rng;
+    xoshiro_seed(&rng, 0x5EED0000ULL + b->id);
+
+    ClientGame * games = (ClientGame *) calloc(b->in_flight, sizeof(ClientGame));
+    ServerRequest * requests = (ServerRequest *) malloc(sizeof(ServerRequest) * b->in_flight);
+    ServerResponse * responses = (ServerResponse *) malloc(sizeof(ServerResponse) * b->in_flight);
+    int * sender = (int *) malloc(sizeof(int) * b->in_flight); // game that sent each request of the round
+    int started = 0;
+
+    while (true) {
+
+        int n = 0;
+
+        for (int k = 0; k < b->in_flight; k ++) {
+
+            ClientGame * g = &games[k];
+            ServerRequest req = {0, 0, 0, 0, g->id};
+
+            if (g->state == CLIENT_IDLE) {
+                if (started == b->num_games) continue;
+                started ++;
+                req.type = REQUEST_NEW_GAME;
+                req.arg = b->strategy;
+            } else if (g->state == CLIENT_STARTED) {
+                req.type = REQUEST_PLACE_RANDOM;
+            } else {
+                req.type = REQUEST_SHOT;
+                req.cell = g->order[g->next ++];
+            }
+
+            sender[n] = k;
+            requests[n ++] = req;
+        }
+
+        if (n == 0) break;
+
+        uint64_t start = latency_now_ns();
+
+        if ( !write_all(fd, requests, n * sizeof(ServerRequest)) || !read_all(fd, responses, n * sizeof(ServerResponse)) ) {
+            printf("thread %d: the connection broke\n", b->id);
+            b->errors ++;
+            break;
+        }
+
+        latency_record_n(&b->latency, latency_now_ns() - start, n);
+
+        for (int r = 0; r < n; r ++) {
+
+            ClientGame * g = &games[sender[r]];
+            ServerResponse * res = &responses[r];
+
+            if (res->status != STATUS_OK) {
+                b->errors ++;
+                if (g->state != CLIENT_IDLE) { // give the game up, its response isn't waited for
+                    ServerRequest end = {REQUEST_END, 0, 0, 0, g->id};
+                    write_all(fd, &end, sizeof(end));
+                    read_all(fd, res, sizeof(ServerResponse));
+                }
+                g->state = CLIENT_IDLE;
+                continue;
+            }
+
+            switch (g->state) {
+
+            case CLIENT_IDLE:
+                g->id = res->game;
+                g->state = CLIENT_STARTED;
+                break;
+
+            case CLIENT_STARTED:
+                shuffle_cells(g, &rng);
+                g->state = CLIENT_PLAYING;
+                break;
+
+            case CLIENT_PLAYING:
+                if (res->winner == WINNER_CLIENT) b->games_won ++;
+                if (res->winner == WINNER_SERVER) b->games_lost ++;
+                if (res->winner != WINNER_NONE) g->state = CLIENT_IDLE;
+                break;
+            }
+        }
+    }
+
+    close(fd);
+    free(games);
+    free(requests);
+    free(responses);
+    free(sender);
+
+    return NULL;
+}
+
+int main(int argc, char ** argv) {
+
+    const char * path = argc > 1 ? argv[1] : "/tmp/battleship.sock";
+    int num_threads = argc > 2 ? atoi(argv[2]) : 4;
+    int in_flight = argc > 3 ? atoi(argv[3]) : 64;
+    int num_games = argc > 4 ? atoi(argv[4]) : 100000;
+    int strategy = 0;
+
+    if (argc > 5) {
+
+        strategy = -1;
+
+        for (int s = 0; s < 2; s ++) {
+            if (strcmp(argv[5], STRATEGY_NAMES[s]) == 0) strategy = s;
+        }
+
+        if (strategy == -1) {
+            printf("The server plays either random or density\n");
+            return 1;
+        }
+    }
+
+    if (num_threads < 1 || in_flight < 1 || num_games < 1) {
+        printf("usage: server_bench [socket_path] [num_threads] [games_in_flight] [num_games] [strategy]\n");
+        return 1;
+    }
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+    BenchThread * bench = (BenchThread *) calloc(num_threads, sizeof(BenchThread));
+
+    printf("Playing %d games against %s on %d connections, %d games in flight each\n\n", num_games,
+           STRATEGY_NAMES[strategy], num_threads, in_flight);
+
+    uint64_t start = latency_now_ns();
+
+    for (int k = 0; k < num_threads; k ++) {
+        bench[k].path = path;
+        bench[k].id = k;
+        bench[k].in_flight = in_flight;
+        bench[k].num_games = (int) ((long) num_games * (k + 1) / num_threads - (long) num_games * k / num_threads);
+        bench[k].strategy = strategy;
+        pthread_create(&threads[k], NULL, bench_thread, &bench[k]);
+    }
+
+    LatencyHistogram latency;
+    int won = 0, lost = 0;
+    long errors = 0;
+
+    latency_reset(&latency);
+
+    for (int k = 0; k < num_threads; k ++) {
+        pthread_join(threads[k], NULL);
+        latency_merge(&latency, &bench[k].latency);
+        won += bench[k].games_won;
+        lost += bench[k].games_lost;
+        errors += bench[k].errors;
+    }
+
+    double elapsed = (latency_now_ns() - start) * 1E-9;
+
+    printf("%llu requests in %.3f s: %.0f requests/s, %.0f games/s\n", (unsigned long long) latency.total, elapsed,
+           latency.total / elapsed, (won + lost) / elapsed);
+    printf("Client won %d games, server won %d, %ld errors\n\n", won, lost, errors);
+
+    latency_print("round trip", &latency);
+
+    free(threads);
+    free(bench);
+
+    return errors ? 2 : 0;
+}
@@ -0,0 +1,110 @@
+// Regarder une partie IA contre IA
+//
+// Play a single AI-vs-AI game and draw every shot. After the first frame only the cells that changed
+// are sent to the terminal (see battleship_render.h), so a game can be watched over a slow link.
+//
+// usage: spectate [strategy_a] [strategy_b] [delay_ms] [seed] [budget_ms] [threads]
+//
+// `budget_ms` and `threads` set the time allowed for each decision of the montecarlo strategy and the
+// number of threads sampling fleets.
+//
+// The left board is strategy_a's fleet, the right board is what strategy_a knows of strategy_b's fleet.
+//
+// Set BATTLESHIP_TIMING to "report" or to a file name to see how the time splits between the decisions,
+// the rendering and the delay (battleship_timing.h).
+
+#include "battleship_ai.h"
+#include "battleship_cli.h"
+#include "battleship_render.h"
+#include "battleship_timing.h"
+#include <time.h>
+
+int main(int argc, char ** argv) {
+
+    AIStrategy strategies[2] = {AI_DENSITY, AI_DENSITY};
+    int delay_ms = 50;
+    uint64_t seed = (uint64_t) time(NULL);
+
+    for (int k = 0; k < 2; k ++) {
+
+        if (argc > 1 + k) {
+
+            int strategy = ai_strategy_from_name(argv[1 + k]);
+
+            if (strategy == -1) {
+                printf("Unknown strategy '%s', choose one of:", argv[1 + k]);
+                for (int s = 0; s < NUM_AI_STRATEGIES; s ++) {
+                    printf(" %s", AI_STRATEGY_NAMES[s]);
+                }
+                printf("\n");
+                return 1;
+            }
+
+            strategies[k] = strategy;
+        }
+    }
+
+    timing_init_from_env();
+
+    if (argc > 3) delay_ms = atoi(argv[3]);
+    if (argc > 4) seed = strtoull(argv[4], NULL, 10);
+    if (argc > 5) MONTE_CARLO_DEFAULTS.budget_ms = atof(argv[5]);
+    if (argc > 6) MONTE_CARLO_DEFAULTS.num_threads = atoi(argv[6]);
+
+    MonteCarlo mc;
+    monte_carlo_init(&mc, MONTE_CARLO_DEFAULTS);
+
+    XoshiroState rng;
+    xoshiro_seed(&rng, seed);
+
+    DockingStation ds[2] = {make_new_game(BOARD_SIZE), make_new_game(BOARD_SIZE)};
+
+    AI ais[2] = {
+        {.human_ds = &ds[1], .ai_ds = &ds[0], .strategy = strategies[0], .rng = &rng, .monte_carlo = &mc},
+        {.human_ds = &ds[0], .ai_ds = &ds[1], .strategy = strategies[1], .rng = &rng, .monte_carlo = &mc},
+    };
+
+    ai_reset(&ais[0]);
+    ai_reset(&ais[1]);
+
+    if ( !ai_place_ships(&ais[0]) || !ai_place_ships(&ais[1]) ) {
+        printf("A fleet could not be placed on its board\n");
+        monte_carlo_destroy(&mc);
+        free(ds[0].board);
+        free(ds[1].board);
+        return 1;
+    }
+
+    FrameBuffer fb = {0};
+
+    clear_screen();
+    render_docking_station(&fb, &ds[0], &ds[1], false);
+
+    int turn = 0, i = 0, j = 0;
+    int shots[2] = {0, 0};
+    ShotResult result;
+
+    do {
+
+        result = ai_take_shot(&ais[turn], &i, &j);
+        shots[turn] ++;
+
+        uint64_t start = timing_start();
+        render_docking_station(&fb, &ds[0], &ds[1], true);
+        timing_stop(PHASE_RENDER, start);
+
+        dsleep(delay_ms / 1000.0);
+
+        if (!result.game_over) turn = 1 - turn;
+
+    } while (!result.game_over);
+
+    printf("%s (%s) won after %d shots\n", turn == 0 ? "Left" : "Right", AI_STRATEGY_NAMES[strategies[turn]], shots[turn]);
+
+    frame_free(&fb);
+    monte_carlo_destroy(&mc);
+    free(ds[0].board);
+    free(ds[1].board);
+
+    return 0;
+}
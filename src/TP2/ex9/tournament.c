@@ -0,0 +1,430 @@
+// Tournoi de bataille navale IA contre IA
+//
+// Play N AI-vs-AI games across a pool of threads and report games/sec, the distribution of the
+// number of shots needed to win and the win rate of each strategy.
+//
+// usage: tournament [num_games] [num_threads] [strategy_a] [strategy_b] [seed] [board] [record_file] [book_file] [rules]
+//
+// `board` is a board configuration such as "1024x1024:5*100,4*100,3*200,2*100" (see battleship_config.h).
+// The classic 10x10 game is the real game, played by the AIs of battleship_ai.h. Any other board is a
+// stress game of the Field harness, whose strategies are random and hunttarget (battleship_field_ai.h):
+// it shows how the harness scales, not how density or montecarlo would play on a larger board.
+//
+// Classic games can be appended to `record_file` as GameRecords (battleship_record.h) to be mined later
+// with replay_stats. Each classic game draws from a generator seeded with the tournament seed and the
+// index of the game, so that any single game can be played again.
+//
+// With a placement book (see optimize_placement), A places its fleets from the book and B at random.
+// Pass "-" as the record_file to use a book without recording, and as the book_file to pick the rules
+// without a book. The rules are "classic", one shot per turn, or "salvo", one shot per ship afloat
+// (classic boards only).
+
+#include "battleship_ai.h"
+#include "battleship_config.h"
+#include "battleship_field_ai.h"
+#include "battleship_record.h"
+#include <pthread.h>
+#include <time.h>
+
+typedef struct GameOutcome {
+
+    uint8_t winner;     // 0 if strategy_a won, 1 if strategy_b won
+    int32_t shots;      // number of shots fired by the winner
+
+} GameOutcome;
+
+typedef struct Tournament {
+
+    int num_games;
+    AIStrategy strategies[2];
+    FieldStrategy field_strategies[2];  // in the stress games
+    const char * names[2];
+    uint64_t seed;
+    BoardConfig config;
+    GameOutcome * outcomes;
+    TranspositionTable * cache;     // decisions shared by every AI of every thread
+    const char * record_path;       // NULL when the games aren't recorded
+    PlacementBook * book;           // fleets of strategy_a on classic boards, NULL to draw them at random
+    bool salvo;
+    pthread_mutex_t record_lock;
+    bool record_failed;
+    bool placement_failed;          // some fleet couldn't be placed on its board, the games stop
+
+} Tournament;
+
+#define RECORD_BATCH 256
+#define FIELD_PLACEMENT_TRIES 16
+#define TOURNAMENT_CACHE_ENTRIES (1 << 16)
+
+// Append the records buffered by a worker to the record file
+void flush_records(Tournament * t, const GameRecord * records, int n) {
+
+    pthread_mutex_lock(&t->record_lock);
+
+    if ( n > 0 && !t->record_failed && !record_append(t->record_path, records, n) ) {
+        t->record_failed = true;
+    }
+
+    pthread_mutex_unlock(&t->record_lock);
+}
+
+uint64_t game_seed(const Tournament * t, int game) {
+    return t->seed ^ (0x9E3779B97F4A7C15ULL * (game + 1));
+}
+
+typedef struct Worker {
+
+    Tournament * tournament;
+    int id;
+    int first_game;
+    int last_game; // exclusive
+
+} Worker;
+
+double now_seconds() {
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1E-9;
+}
+
+// Stress games, on a board that isn't the classic one
+void * play_field_games(void * arg) {
+
+    Worker * w = (Worker *) arg;
+    Tournament * t = w->tournament;
+
+    XoshiroState rng;
+    xoshiro_seed(&rng, t->seed ^ (0x9E3779B97F4A7C15ULL * (w->id + 1)));
+
+    Field fields[2] = {field_new(&t->config), field_new(&t->config)};
+
+    // ais[k] plays field_strategies[k] and shoots at the other field
+    FieldAI ais[2] = {field_ai_new(&fields[1], t->field_strategies[0], &rng), field_ai_new(&fields[0], t->field_strategies[1], &rng)};
+
+    for (int g = w->first_game; g < w->last_game; g ++) {
+
+        // a crowded fleet may be blocked by the ships placed before it, try again from an empty field
+        bool placed = true;
+
+        for (int k = 0; k < 2 && placed; k ++) {
+
+            placed = false;
+
+            for (int attempt = 0; attempt < FIELD_PLACEMENT_TRIES && !placed; attempt ++) {
+                field_reset(&fields[k]);
+                placed = field_place_fleet_random(&fields[k], &rng);
+            }
+        }
+
+        if (!placed || __atomic_load_n(&t->placement_failed, __ATOMIC_RELAXED)) {
+            __atomic_store_n(&t->placement_failed, true, __ATOMIC_RELAXED);
+            break;
+        }
+
+        field_ai_reset(&ais[0]);
+        field_ai_reset(&ais[1]);
+
+        int first = g & 1;
+        int shots = 0;
+        int winner = field_ai_vs_ai(&ais[first], &ais[1 - first], &shots);
+
+        if (winner == -1) {
+            __atomic_store_n(&t->placement_failed, true, __ATOMIC_RELAXED);
+            break;
+        }
+
+        t->outcomes[g].winner = winner == 0 ? first : 1 - first;
+        t->outcomes[g].shots = shots;
+    }
+
+    for (int k = 0; k < 2; k ++) {
+        field_ai_free(&ais[k]);
+        field_free(&fields[k]);
+    }
+
+    return NULL;
+}
+
+void * play_games(void * arg) {
+
+    Worker * w = (Worker *) arg;
+    Tournament * t = w->tournament;
+
+    // every worker gets its own generator, reseeded for each game from the tournament seed
+    XoshiroState rng;
+
+    DockingStation ds[2] = {make_new_game(BOARD_SIZE), make_new_game(BOARD_SIZE)};
+
+    GameRecord * records = t->record_path ? (GameRecord *) malloc(sizeof(GameRecord) * RECORD_BATCH) : NULL;
+    int num_records = 0;
+
+    for (int g = w->first_game; g < w->last_game; g ++) {
+
+        xoshiro_seed(&rng, game_seed(t, g));
+
+        reset_docking_station(&ds[0]);
+        reset_docking_station(&ds[1]);
+
+        // ais[k] plays strategies[k] and shoots at the other docking station
+        AI ais[2] = {
+            {.human_ds = &ds[1], .ai_ds = &ds[0], .strategy = t->strategies[0], .rng = &rng, .cache = t->cache, .book = t->book},
+            {.human_ds = &ds[0], .ai_ds = &ds[1], .strategy = t->strategies[1], .rng = &rng, .cache = t->cache},
+        };
+
+        ai_reset(&ais[0]);
+        ai_reset(&ais[1]);
+
+        if ( !ai_place_ships(&ais[0]) || !ai_place_ships(&ais[1]) || __atomic_load_n(&t->placement_failed, __ATOMIC_RELAXED) ) {
+            __atomic_store_n(&t->placement_failed, true, __ATOMIC_RELAXED);
+            break;
+        }
+
+        // alternate who shoots first so that neither strategy gets the first move advantage
+        int first = g & 1;
+        int shots = 0;
+        GameRecord * record = NULL;
+
+        if (records) {
+            // side 0 of the record is the AI that shoots first
+            record = &records[num_records ++];
+            record_init(record, game_seed(t, g), t->strategies[first], t->strategies[1 - first]);
+            record_fleet(record, 0, ds[first].board);
+            record_fleet(record, 1, ds[1 - first].board);
+        }
+
+        int winner = t->salvo ? ai_vs_ai_salvo(&ais[first], &ais[1 - first], &shots, record)
+                              : ai_vs_ai(&ais[first], &ais[1 - first], &shots, record);
+
+        t->outcomes[g].winner = winner == 0 ? first : 1 - first;
+        t->outcomes[g].shots = shots;
+
+        if (num_records == RECORD_BATCH) {
+            flush_records(t, records, num_records);
+            num_records = 0;
+        }
+    }
+
+    if (records) {
+        flush_records(t, records, num_records);
+        free(records);
+    }
+
+    free(ds[0].board);
+    free(ds[1].board);
+
+    return NULL;
+}
+
+int compare_ints(const void * a, const void * b) {
+    return *(const int *) a - *(const int *) b;
+}
+
+// percentile of an array that is already sorted
+int percentile(const int * sorted, int n, double p) {
+
+    if (n == 0) return 0;
+
+    int index = (int) (p * (n - 1) + 0.5);
+    return sorted[index];
+}
+
+void print_shot_stats(const char * label, int * shots, int n) {
+
+    if (n == 0) {
+        printf("%-13s no wins\n", label);
+        return;
+    }
+
+    qsort(shots, n, sizeof(int), compare_ints);
+
+    double sum = 0;
+    for (int i = 0; i < n; i ++) {
+        sum += shots[i];
+    }
+
+    printf("%-13s mean %6.2f   p50 %3d   p99 %3d\n", label, sum / n, percentile(shots, n, 0.5), percentile(shots, n, 0.99));
+}
+
+int main(int argc, char ** argv) {
+
+    Tournament t = {.num_games = 10000, .strategies = {AI_RANDOM, AI_RANDOM}, .field_strategies = {FIELD_RANDOM, FIELD_RANDOM},
+                    .seed = (uint64_t) time(NULL), .config = classic_config()};
+    int num_threads = 4;
+
+    if (argc > 1) t.num_games = atoi(argv[1]);
+    if (argc > 2) num_threads = atoi(argv[2]);
+
+    if (argc > 5) t.seed = strtoull(argv[5], NULL, 10);
+
+    if (argc > 6) {
+        free_config(&t.config);
+        if ( !parse_config(argv[6], &t.config) ) return 3;
+    }
+
+    bool classic = is_classic_config(&t.config);
+
+    // the stress games have strategies of their own
+    const char ** names = classic ? AI_STRATEGY_NAMES : FIELD_STRATEGY_NAMES;
+    int num_names = classic ? NUM_AI_STRATEGIES : NUM_FIELD_STRATEGIES;
+
+    for (int k = 0; k < 2; k ++) {
+
+        if (argc > 3 + k) {
+
+            int strategy = classic ? ai_strategy_from_name(argv[3 + k]) : field_strategy_from_name(argv[3 + k]);
+
+            if (strategy == -1) {
+                printf("Unknown strategy '%s'%s, choose one of:", argv[3 + k], classic ? "" : " for a stress game");
+                for (int s = 0; s < num_names; s ++) {
+                    printf(" %s", names[s]);
+                }
+                printf("\n");
+                return 1;
+            }
+
+            if (classic) t.strategies[k] = strategy;
+            else t.field_strategies[k] = strategy;
+        }
+
+        t.names[k] = names[classic ? (int) t.strategies[k] : (int) t.field_strategies[k]];
+    }
+
+    if (argc > 7 && strcmp(argv[7], "-") != 0) {
+
+        if (!classic) {
+            printf("Only classic games can be recorded\n");
+            return 3;
+        }
+
+        t.record_path = argv[7];
+        pthread_mutex_init(&t.record_lock, NULL);
+    }
+
+    if (argc > 8 && strcmp(argv[8], "-") != 0) {
+
+        if (!classic) {
+            printf("Placement books are only for classic games\n");
+            return 3;
+        }
+
+        if ( (t.book = book_load(argv[8])) == NULL ) {
+            printf("Could not load the placement book %s\n", argv[8]);
+            return 3;
+        }
+
+        printf("A places its fleets from %s: %u fleets chosen against %s\n", argv[8], t.book->header.num_fleets,
+               AI_STRATEGY_NAMES[t.book->header.strategy < NUM_AI_STRATEGIES ? t.book->header.strategy : 0]);
+    }
+
+    if (argc > 9) {
+
+        t.salvo = strcmp(argv[9], "salvo") == 0;
+
+        if ( !t.salvo && strcmp(argv[9], "classic") != 0 ) {
+            printf("Unknown rules '%s', choose classic or salvo\n", argv[9]);
+            return 3;
+        }
+
+        if (t.salvo && !classic) {
+            printf("Salvo games are only played on classic boards\n");
+            return 3;
+        }
+    }
+
+    if (t.num_games <= 0 || num_threads <= 0) {
+        printf("The number of games and the number of threads must be strictly positive\n");
+        return 2;
+    }
+
+    t.outcomes = (GameOutcome *) malloc(sizeof(GameOutcome) * t.num_games);
+
+    // density decisions are cheaper to make again than to look up, only the Monte Carlo ones are cached
+    if (classic && (t.strategies[0] == AI_MONTE_CARLO || t.strategies[1] == AI_MONTE_CARLO)) {
+        t.cache = transposition_new(TOURNAMENT_CACHE_ENTRIES);
+    }
+
+    pthread_t * threads = (pthread_t *) malloc(sizeof(pthread_t) * num_threads);
+    Worker * workers = (Worker *) malloc(sizeof(Worker) * num_threads);
+
+    printf("Playing %d games of %s vs %s on %d threads (seed %llu)\n", t.num_games, t.names[0], t.names[1], num_threads,
+           (unsigned long long) t.seed);
+    printf("%dx%d board with %d ships%s%s\n\n", t.config.rows, t.config.cols, t.config.num_ships,
+           classic ? " (classic)" : " (stress game)", t.salvo ? ", salvo rules" : "");
+
+    double start = now_seconds();
+
+    for (int i = 0; i < num_threads; i ++) {
+        workers[i].tournament = &t;
+        workers[i].id = i;
+        workers[i].first_game = (int) ((long) t.num_games * i / num_threads);
+        workers[i].last_game = (int) ((long) t.num_games * (i + 1) / num_threads);
+        pthread_create(&threads[i], NULL, classic ? play_games : play_field_games, &workers[i]);
+    }
+
+    for (int i = 0; i < num_threads; i ++) {
+        pthread_join(threads[i], NULL);
+    }
+
+    double elapsed = now_seconds() - start;
+
+    if (t.placement_failed) {
+        if (argc > 6) printf("The fleet of %s could not be placed on its board, the tournament was stopped\n", argv[6]);
+        else printf("A fleet could not be placed on its board, the tournament was stopped\n");
+        free(workers);
+        free(threads);
+        free(t.outcomes);
+        free_config(&t.config);
+        return 3;
+    }
+
+    // gather the number of shots to win, overall and for each side
+    int * all_shots = (int *) malloc(sizeof(int) * t.num_games);
+    int * side_shots[2] = {(int *) malloc(sizeof(int) * t.num_games), (int *) malloc(sizeof(int) * t.num_games)};
+    int wins[2] = {0, 0};
+
+    for (int g = 0; g < t.num_games; g ++) {
+        int winner = t.outcomes[g].winner;
+        all_shots[g] = t.outcomes[g].shots;
+        side_shots[winner][wins[winner]] = t.outcomes[g].shots;
+        wins[winner] ++;
+    }
+
+    printf("%d games in %.3f s: %.1f games/sec\n\n", t.num_games, elapsed, t.num_games / elapsed);
+
+    if (t.cache) {
+        printf("Decision cache: %llu lookups, %llu hits (%.2f%%)\n\n", (unsigned long long) t.cache->lookups,
+               (unsigned long long) t.cache->hits, 100.0 * transposition_hit_rate(t.cache));
+        transposition_free(t.cache);
+    }
+
+    if (t.record_path) {
+        if (t.record_failed) printf("Could not write every game to %s\n\n", t.record_path);
+        else printf("Recorded %d games in %s\n\n", t.num_games, t.record_path);
+    }
+
+    printf("Shots to win\n");
+    print_shot_stats("all", all_shots, t.num_games);
+
+    for (int k = 0; k < 2; k ++) {
+        char label[32];
+        snprintf(label, sizeof(label), "%c: %s", 'A' + k, t.names[k]);
+        print_shot_stats(label, side_shots[k], wins[k]);
+    }
+
+    printf("\nWin rate\n");
+    for (int k = 0; k < 2; k ++) {
+        printf("%c: %-10s %6.2f%%  (%d wins)\n", 'A' + k, t.names[k], 100.0 * wins[k] / t.num_games, wins[k]);
+    }
+
+    free(all_shots);
+    free(side_shots[0]);
+    free(side_shots[1]);
+    free(workers);
+    free(threads);
+    free(t.outcomes);
+    book_free(t.book);
+    free_config(&t.config);
+
+    return 0;
+}